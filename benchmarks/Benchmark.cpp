@@ -0,0 +1,149 @@
+#include "Benchmark.hpp"
+#include "util/JsonEscape.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <ctime>
+#endif
+
+namespace YimMenu::Benchmarks
+{
+	struct Suite
+	{
+		std::string_view m_Name;
+		BenchmarkFunc m_Func;
+	};
+
+	static std::vector<Suite>& GetSuites()
+	{
+		static std::vector<Suite> suites;
+		return suites;
+	}
+
+	struct Result
+	{
+		std::string_view m_Suite;
+		std::string m_Name;
+		std::size_t m_Iterations;
+		Timing m_Timing;
+	};
+
+	static std::string_view g_CurrentSuite;
+	static std::vector<Result> g_Results;
+	static std::size_t g_FailedChecks = 0;
+
+	Registration::Registration(std::string_view name, BenchmarkFunc func)
+	{
+		GetSuites().push_back({name, func});
+	}
+
+	double CpuTimeMs()
+	{
+#ifdef _WIN32
+		FILETIME creation, exit, kernel, user;
+		if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+			return 0.0;
+
+		const auto toMs = [](const FILETIME& time) {
+			return ((static_cast<std::uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) / 10000.0;
+		};
+		return toMs(kernel) + toMs(user);
+#else
+		timespec time{};
+		clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+		return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+#endif
+	}
+
+	void Report(std::string_view name, std::size_t iterations, const Timing& timing)
+	{
+		// microseconds, some of the hot paths take less than one
+		std::cout << std::left << std::setw(24) << g_CurrentSuite << std::setw(40) << name << std::right << std::fixed
+		          << std::setprecision(3) << std::setw(14) << timing.m_WallMs * 1000 / iterations << " us wall" << std::setw(14)
+		          << timing.m_CpuMs * 1000 / iterations << " us cpu  (x" << iterations << ")" << std::endl;
+
+		g_Results.push_back({g_CurrentSuite, std::string(name), iterations, timing});
+	}
+
+	void Check(bool condition, std::string_view what)
+	{
+		if (condition)
+			return;
+
+		std::cerr << g_CurrentSuite << ": check failed: " << what << std::endl;
+		g_FailedChecks++;
+	}
+
+	// one object per measurement, times are per iteration so runs with different iteration counts compare
+	static bool WriteJson(const std::filesystem::path& file)
+	{
+		std::ofstream stream(file, std::ios::trunc);
+		stream << std::setprecision(9) << "[\n";
+		for (std::size_t i = 0; i < g_Results.size(); i++)
+		{
+			const auto& result = g_Results[i];
+			stream << "  {\"suite\": \"";
+			WriteJsonEscaped(stream, result.m_Suite);
+			stream << "\", \"name\": \"";
+			WriteJsonEscaped(stream, result.m_Name);
+			stream << "\", \"iterations\": " << result.m_Iterations << ", \"wall_ms\": " << result.m_Timing.m_WallMs / result.m_Iterations
+			       << ", \"cpu_ms\": " << result.m_Timing.m_CpuMs / result.m_Iterations << (i + 1 < g_Results.size() ? "},\n" : "}\n");
+		}
+		stream << "]\n";
+		return static_cast<bool>(stream);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace YimMenu::Benchmarks;
+
+	std::string_view filter;
+	std::filesystem::path json;
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string_view arg = argv[i];
+		if (arg == "--json" && i + 1 < argc)
+			json = argv[++i];
+		else if (filter.empty() && !arg.starts_with("--"))
+			filter = arg;
+		else
+		{
+			std::cerr << "usage: " << argv[0] << " [filter] [--json <results.json>]" << std::endl;
+			return 2;
+		}
+	}
+
+	for (const auto& suite : GetSuites())
+	{
+		if (!filter.empty() && suite.m_Name.find(filter) == std::string_view::npos)
+			continue;
+
+		g_CurrentSuite = suite.m_Name;
+		suite.m_Func();
+	}
+
+	if (!json.empty() && !WriteJson(json))
+	{
+		std::cerr << "Failed to write " << json << std::endl;
+		return 1;
+	}
+
+	if (g_FailedChecks)
+	{
+		std::cerr << g_FailedChecks << " check(s) failed" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace YimMenu::Benchmarks
+{
+	struct Timing
+	{
+		double m_WallMs;
+		double m_CpuMs;
+	};
+
+	using BenchmarkFunc = void (*)();
+
+	/**
+	 * @brief Registers a benchmark suite at static initialization time, see BENCHMARK()
+	 */
+	struct Registration
+	{
+		Registration(std::string_view name, BenchmarkFunc func);
+	};
+
+	/**
+	 * @brief Process CPU time (all threads) in milliseconds
+	 */
+	double CpuTimeMs();
+
+	/**
+	 * @brief Prints a single measurement of the running suite, it is also part of the --json output
+	 * 
+	 * @param name Name of the measured case
+	 * @param iterations Amount of times the case ran inside the measurement
+	 * @param timing Total time of all iterations
+	 */
+	void Report(std::string_view name, std::size_t iterations, const Timing& timing);
+
+	/**
+	 * @brief Fails the run if condition is false, the remaining suites still run and the process exits with 1
+	 *
+	 * @param condition What the suite expects to hold
+	 * @param what Description of the expectation, printed when it does not
+	 */
+	void Check(bool condition, std::string_view what);
+
+	/**
+	 * @brief Keeps the compiler from optimizing away a value that is otherwise unused
+	 */
+	template<typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+#ifdef _MSC_VER
+		// no inline assembly on x64 MSVC, a volatile read of the object has the same effect
+		static_cast<void>(*reinterpret_cast<const volatile char*>(&value));
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	template<typename F>
+	inline Timing Measure(std::size_t iterations, F&& func)
+	{
+		const auto cpuStart  = CpuTimeMs();
+		const auto wallStart = std::chrono::steady_clock::now();
+
+		for (std::size_t i = 0; i < iterations; i++)
+			func();
+
+		const auto wall = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallStart);
+		return {wall.count(), CpuTimeMs() - cpuStart};
+	}
+}
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+#define BENCHMARK(name)                                                                                                    \
+	static void BENCHMARK_CONCAT(Benchmark_, name)();                                                                      \
+	static const YimMenu::Benchmarks::Registration BENCHMARK_CONCAT(g_Registration_, name)(#name, &BENCHMARK_CONCAT(Benchmark_, name)); \
+	static void BENCHMARK_CONCAT(Benchmark_, name)()
@@ -0,0 +1,35 @@
+#include "Benchmark.hpp"
+#include "core/misc/FlightRecorder.hpp"
+
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+namespace YimMenu::Benchmarks
+{
+	BENCHMARK(FlightRecorder)
+	{
+		// the hooks record one event per received message, net event and clone sync
+		std::uint64_t i = 0;
+		Report("Record", 10000000, Measure(10000000, [&] {
+			FlightRecorder::Record(FlightEvent::CLONE_SYNC, 4, i++, 1);
+		}));
+
+		// the game thread and the network thread record at the same time
+		Report("Record (4 threads)", 4000000, Measure(1, [] {
+			std::vector<std::jthread> threads;
+			for (int t = 0; t < 4; t++)
+				threads.emplace_back([t] {
+					for (std::uint64_t i = 0; i < 1000000; i++)
+						FlightRecorder::Record(FlightEvent::NET_EVENT, i, t, 0);
+				});
+		}));
+
+		// what the exception handler pays for a full ring
+		const auto file = std::filesystem::temp_directory_path() / "terminus_flight_benchmark.bin";
+		Report("Dump (" + std::to_string(FlightRecorder::g_Capacity) + " events)", 100, Measure(100, [&] {
+			DoNotOptimize(FlightRecorder::Dump(file));
+		}));
+		std::filesystem::remove(file);
+	}
+}
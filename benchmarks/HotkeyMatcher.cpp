@@ -0,0 +1,66 @@
+#include "Benchmark.hpp"
+#include "core/commands/HotkeyMatcher.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace YimMenu::Benchmarks
+{
+	BENCHMARK(HotkeyMatcher)
+	{
+		// 64 chords of one modifier and one or two letters, roughly what a heavily customized profile has
+		std::mt19937 rng(42);
+		std::vector<std::vector<int>> chords;
+		for (int i = 0; i < 64; i++)
+		{
+			std::vector<int> chord{0x10 + i % 3, 0x41 + i % 26};
+			if (i % 4 == 0)
+				chord.push_back(0x30 + i % 10);
+			chords.push_back(std::move(chord));
+		}
+
+		HotkeyMatcher matcher;
+		for (std::uint32_t i = 0; i < chords.size(); i++)
+			matcher.Add(i, chords[i]);
+
+		// a key stream at 60 ticks per second where a key changes state every few ticks
+		std::vector<HotkeyMatcher::KeyState> stream(4096);
+		HotkeyMatcher::KeyState keys;
+		for (auto& state : stream)
+		{
+			if (rng() % 4 == 0)
+				keys.flip(0x10 + rng() % 3);
+			if (rng() % 4 == 0)
+				keys.flip(0x41 + rng() % 26);
+			state = keys;
+		}
+
+		// the old HotkeySystem::Update polled every key of every chain
+		std::size_t polls = 0;
+		for (const auto& chord : chords)
+			polls += chord.size();
+
+		Report("naive, " + std::to_string(polls) + " key polls per tick", 1000, Measure(1000, [&] {
+			std::size_t held = 0;
+			for (const auto& state : stream)
+			{
+				for (const auto& chord : chords)
+				{
+					bool all = true;
+					for (auto key : chord)
+						all &= state.test(key);
+					held += all;
+				}
+			}
+			DoNotOptimize(held);
+		}));
+
+		Report("indexed, " + std::to_string(matcher.GetWatchedKeys().size()) + " key polls per tick", 1000, Measure(1000, [&] {
+			std::size_t held = 0;
+			for (const auto& state : stream)
+				held += matcher.Update(state).size();
+			DoNotOptimize(held);
+		}));
+	}
+}
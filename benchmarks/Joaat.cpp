@@ -0,0 +1,33 @@
+#include "Benchmark.hpp"
+#include "util/Joaat.hpp"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "game/rdr/data/ScriptNames.hpp"
+
+namespace YimMenu::Benchmarks
+{
+	BENCHMARK(Joaat)
+	{
+		// script names are the most common runtime input, mostly short lower case identifiers
+		std::vector<std::string> names;
+		for (const auto& [hash, name] : Data::g_SpScriptNames)
+			names.emplace_back(name);
+
+		const auto hashNames = [&] {
+			joaat_t combined = 0;
+			for (const auto& name : names)
+				combined ^= Joaat(name);
+			DoNotOptimize(combined);
+		};
+		Report("script names (" + std::to_string(names.size()) + ")", 1000, Measure(1000, hashNames));
+
+		const std::string longString(4096, 'A');
+		Report("4 KiB mixed case string", 10000, Measure(10000, [&] {
+			DoNotOptimize(Joaat(longString));
+		}));
+	}
+}
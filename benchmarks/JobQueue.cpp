@@ -0,0 +1,161 @@
+#include "Benchmark.hpp"
+#include "core/misc/JobQueue.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stack>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace YimMenu::Benchmarks
+{
+	namespace
+	{
+		// the game runs the five pool fibers once per tick, one after another on the game thread
+		constexpr int g_Fibers            = 5;
+		constexpr auto g_JobCost          = std::chrono::microseconds(100); // a few natives
+		constexpr auto g_TickBudget       = std::chrono::milliseconds(2);
+		constexpr std::size_t g_BurstSize = 50;
+
+		void BusyWait(std::chrono::nanoseconds duration)
+		{
+			const auto end = std::chrono::steady_clock::now() + duration;
+			while (std::chrono::steady_clock::now() < end)
+				;
+		}
+
+		struct Job
+		{
+			std::function<void()> m_Callback;
+		};
+
+		// what FiberPool did before, a locked stack and one job per fiber per tick
+		int SimulateStack(std::vector<std::size_t>& order)
+		{
+			std::recursive_mutex mutex;
+			std::stack<Job> jobs;
+			for (std::size_t i = 0; i < g_BurstSize; i++)
+				jobs.push({[&order, i] {
+					BusyWait(g_JobCost);
+					order.push_back(i);
+				}});
+
+			int ticks = 0;
+			while (!jobs.empty())
+			{
+				ticks++;
+				for (int fiber = 0; fiber < g_Fibers; fiber++)
+				{
+					std::unique_lock lock(mutex);
+					if (jobs.empty())
+						break;
+					auto job = std::move(jobs.top());
+					jobs.pop();
+					lock.unlock();
+					job.m_Callback();
+				}
+			}
+			return ticks;
+		}
+
+		int SimulateQueue(JobQueue<Job>& queue, std::vector<std::size_t>& order)
+		{
+			for (std::size_t i = 0; i < g_BurstSize; i++)
+				queue.Push({[&order, i] {
+					BusyWait(g_JobCost);
+					order.push_back(i);
+				}},
+				    JobPriority::INTERACTIVE);
+
+			int ticks = 0;
+			while (queue.GetStats().m_Depth[0])
+			{
+				ticks++;
+				for (int fiber = 0; fiber < g_Fibers; fiber++)
+					queue.Drain(ticks, [](Job& job) {
+						job.m_Callback();
+					});
+			}
+			return ticks;
+		}
+
+		bool IsFifo(const std::vector<std::size_t>& order)
+		{
+			for (std::size_t i = 0; i < order.size(); i++)
+				if (order[i] != i)
+					return false;
+			return true;
+		}
+	}
+
+	BENCHMARK(JobQueue)
+	{
+		// how many ticks a burst of clicks takes to drain, and whether the first click runs first
+		std::vector<std::size_t> order;
+		int ticks = 0;
+		auto timing = Measure(1, [&] {
+			ticks = SimulateStack(order);
+		});
+		Report("stack, burst of " + std::to_string(g_BurstSize) + ": " + std::to_string(ticks) + " ticks, first job ran " + std::to_string(std::ranges::find(order, std::size_t{0}) - order.begin() + 1) + ".", 1, timing);
+
+		JobQueue<Job> queue(1024, g_TickBudget);
+		order.clear();
+		timing = Measure(1, [&] {
+			ticks = SimulateQueue(queue, order);
+		});
+		Report("queue, burst of " + std::to_string(g_BurstSize) + ": " + std::to_string(ticks) + " ticks", 1, timing);
+		Check(order.size() == g_BurstSize && IsFifo(order), "the queue runs a burst in the order it was pushed");
+
+		// a full ring spills into the overflow list without losing the order
+		JobQueue<Job> small(16, std::chrono::hours(1));
+		order.clear();
+		SimulateQueue(small, order);
+		Check(small.GetStats().m_Overflowed > 0, "a burst larger than the ring spills into the overflow list");
+		Check(order.size() == g_BurstSize && IsFifo(order), "jobs that spilled into the overflow list keep their order");
+
+		// interactive work overtakes queued background work, which still gets every g_BackgroundInterval'th slot
+		JobQueue<Job> mixed(1024, std::chrono::hours(1));
+		std::vector<JobPriority> ran;
+		for (int i = 0; i < 32; i++)
+			mixed.Push({[&ran] {
+				ran.push_back(JobPriority::BACKGROUND);
+			}},
+			    JobPriority::BACKGROUND);
+		for (int i = 0; i < 32; i++)
+			mixed.Push({[&ran] {
+				ran.push_back(JobPriority::INTERACTIVE);
+			}},
+			    JobPriority::INTERACTIVE);
+		mixed.Drain(1, [](Job& job) {
+			job.m_Callback();
+		});
+		const auto backgroundInFirst32 = std::ranges::count(ran.begin(), ran.begin() + 32, JobPriority::BACKGROUND);
+		Check(backgroundInFirst32 == 32 / JobQueue<Job>::g_BackgroundInterval, "background jobs get every g_BackgroundInterval'th slot while interactive jobs wait");
+		Check(ran.size() == 64 && std::ranges::count(ran, JobPriority::BACKGROUND) == 32, "an unlimited budget drains both priorities");
+
+		const auto stats = queue.GetStats();
+		Report("burst wait: avg " + std::to_string(stats.m_AverageWaitMs) + " ms, max " + std::to_string(stats.m_MaxWaitMs) + " ms", 1, {});
+
+		// raw push and pop cost, and contention between the game thread and hooks pushing from other threads
+		JobQueue<Job> throughput(1 << 16, std::chrono::hours(1));
+		Job job;
+		Report("push + pop", 1000000, Measure(1000000, [&] {
+			throughput.Push({}, JobPriority::INTERACTIVE);
+			throughput.TryPop(job);
+		}));
+
+		Report("4 producers, 1 consumer", 4000000, Measure(1, [&] {
+			std::vector<std::jthread> threads;
+			for (int t = 0; t < 4; t++)
+				threads.emplace_back([&] {
+					for (int i = 0; i < 1000000; i++)
+						throughput.Push({}, JobPriority::INTERACTIVE);
+				});
+
+			std::size_t popped = 0;
+			while (popped < 4000000)
+				popped += throughput.TryPop(job);
+		}));
+	}
+}
@@ -0,0 +1,37 @@
+#include "Benchmark.hpp"
+#include "core/logger/LogLimiter.hpp"
+
+#include <string>
+
+namespace YimMenu::Benchmarks
+{
+	BENCHMARK(LogLimiter)
+	{
+		constexpr std::size_t info = 1;
+		std::size_t suppressed     = 0;
+		LogLimiter::SetSummaryHandler([](std::size_t, const char*, std::uint32_t, std::uint32_t) {
+		});
+
+		// what every LOG_LIMITED() pays while the limiter is turned off
+		LogLimiter::SetEnabled(false);
+		Report("disabled", 10000000, Measure(10000000, [&] {
+			DoNotOptimize(LOG_LIMITED_ALLOWED(info));
+		}));
+
+		// a flood of one call site, nearly every line is dropped before its stream is built
+		LogLimiter::SetEnabled(true);
+		const auto flood = Measure(1000000, [&] {
+			suppressed += !LOG_LIMITED_ALLOWED(info);
+		});
+		Report("flood (" + std::to_string(suppressed) + " of 1000000 dropped)", 1000000, flood);
+
+		LogLimiter::SetLimit(info, {1000000000, 1000000000});
+		Report("within limit", 1000000, Measure(1000000, [&] {
+			DoNotOptimize(LOG_LIMITED_ALLOWED(info));
+		}));
+
+		LogLimiter::SetLimit(info, {20, 10});
+		LogLimiter::SetEnabled(false);
+		LogLimiter::SetSummaryHandler(nullptr);
+	}
+}
@@ -0,0 +1,71 @@
+#include "Benchmark.hpp"
+#include "core/logger/LogFormat.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <sstream>
+
+namespace YimMenu::Benchmarks
+{
+	// stands in for std::format("{0:%H:%M:%S}", timestamp), which g++ 12 doesn't have, and returns a new string the same way
+	static std::string FormatTime(std::chrono::system_clock::time_point timestamp)
+	{
+		using namespace std::chrono;
+		using Duration        = system_clock::duration;
+		constexpr auto digits = LogFormat::SubsecondDigits<Duration::period>();
+
+		const auto sinceEpoch = timestamp.time_since_epoch();
+		const auto second     = floor<seconds>(sinceEpoch);
+		const hh_mm_ss time(second - floor<days>(second));
+
+		std::string out;
+		LogFormat::AppendDigits(out, time.hours().count(), 2);
+		out += ':';
+		LogFormat::AppendDigits(out, time.minutes().count(), 2);
+		out += ':';
+		LogFormat::AppendDigits(out, time.seconds().count(), 2);
+		if constexpr (digits > 0)
+		{
+			out += '.';
+			LogFormat::AppendDigits(out, (sinceEpoch - second).count(), digits);
+		}
+		return out;
+	}
+
+	// what LogSink::FormatConsole did before
+	static std::string FormatConsoleStream(std::string_view level, int color, std::chrono::system_clock::time_point timestamp, const char* file, std::uint32_t line, std::string_view message)
+	{
+		std::stringstream out;
+
+		const auto time = FormatTime(timestamp);
+		const auto name = std::filesystem::path(file).filename().string();
+
+		out << "[" << time << "]" << "\x1b[" << color << "m" << "[" << level << "/" << name << ":" << line << "] " << "\x1b[0m" << message;
+		return out.str();
+	}
+
+	BENCHMARK(LogSink)
+	{
+		const auto timestamp = std::chrono::system_clock::now();
+		// forward slashes, std::filesystem::path only splits on backslashes on Windows
+		const char* file     = "D:/a/Terminus/Terminus/src/game/hooks/Protections/HandleNetGameEvent.cpp";
+		const std::string message = "Blocked NETWORK_PTFX_EVENT from Player\n";
+
+		LogFormat::LineFormatter formatter;
+		if (FormatConsoleStream("INFO", 32, timestamp, file, 142, message) != formatter.FormatConsole("INFO", 32, timestamp, file, 142, message))
+			std::puts("LogSink: LineFormatter output differs from the stream formatter!");
+
+		Report("FormatConsole, stringstream + path", 100000, Measure(100000, [&] {
+			DoNotOptimize(FormatConsoleStream("INFO", 32, timestamp, file, 142, message));
+		}));
+
+		Report("FormatConsole, LineFormatter", 100000, Measure(100000, [&] {
+			DoNotOptimize(formatter.FormatConsole("INFO", 32, timestamp, file, 142, message).size());
+		}));
+
+		// packet logging, lots of lines from a handful of call sites within the same second
+		Report("FormatFile, LineFormatter", 100000, Measure(100000, [&] {
+			DoNotOptimize(formatter.FormatFile("INFO", timestamp, file, 142, message).size());
+		}));
+	}
+}
@@ -0,0 +1,112 @@
+#include "Benchmark.hpp"
+#include "SyntheticImage.hpp"
+#include "core/memory/ScanEngine.hpp"
+
+#include <future>
+#include <span>
+
+namespace YimMenu::Benchmarks
+{
+	static constexpr std::size_t g_ImageSize    = 4 * 1024 * 1024;
+	static constexpr std::size_t g_PatternCount = 106;
+
+	// the scanner as it was before ScanEngine: one std::async job and one full pass per pattern
+	static std::optional<std::size_t> LegacyScan(std::span<const std::uint8_t> image, const Signature& signature)
+	{
+		for (std::size_t i = 0; i < image.size(); ++i)
+		{
+			if (signature.size() + i > image.size())
+				break;
+
+			bool found = true;
+			for (std::size_t instructionIdx = 0; instructionIdx < signature.size(); ++instructionIdx)
+			{
+				if (signature[instructionIdx] && signature[instructionIdx].value() != image[i + instructionIdx])
+				{
+					found = false;
+				}
+			}
+
+			if (found)
+				return i;
+		}
+		return std::nullopt;
+	}
+
+	BENCHMARK(PatternScanner)
+	{
+		auto image = CreateCodeImage(g_ImageSize);
+
+		std::mt19937 rng(42);
+		std::uniform_int_distribution<std::size_t> length(5, 32);
+		std::uniform_int_distribution<std::size_t> offset(g_ImageSize / 4, g_ImageSize - 64);
+
+		std::vector<Signature> signatures;
+		for (std::size_t i = 0; i < g_PatternCount; i++)
+		{
+			auto& signature = signatures.emplace_back(CreateSignature(rng, length(rng)));
+			PlantSignature(image, signature, offset(rng));
+		}
+
+		std::vector<std::optional<std::size_t>> legacyResults;
+		const auto legacy = Measure(1, [&] {
+			std::vector<std::future<std::optional<std::size_t>>> jobs;
+			for (const auto& signature : signatures)
+				jobs.emplace_back(std::async(&LegacyScan, std::span<const std::uint8_t>(image), std::cref(signature)));
+
+			legacyResults.clear();
+			for (auto& job : jobs)
+				legacyResults.push_back(job.get());
+		});
+		Report("legacy (std::async per pattern)", 1, legacy);
+
+		std::vector<std::optional<std::size_t>> engineResults;
+		const auto engine = Measure(5, [&] {
+			ScanEngine scanEngine(image);
+			for (const auto& signature : signatures)
+				scanEngine.Add(signature);
+			engineResults = scanEngine.Run();
+		});
+		Report("ScanEngine (single pass)", 5, engine);
+
+		const auto engineSingleThread = Measure(5, [&] {
+			ScanEngine scanEngine(image);
+			for (const auto& signature : signatures)
+				scanEngine.Add(signature);
+			engineResults = scanEngine.Run(1);
+		});
+		Report("ScanEngine (single pass, 1 thread)", 5, engineSingleThread);
+
+		Check(legacyResults == engineResults, "ScanEngine finds the same offsets as the legacy scanner");
+
+		// the direct and the indexed scan agree at range ends: a match counts when its first byte is inside a range
+		{
+			auto small = CreateCodeImage(0x5000);
+			auto tail  = Signature(8, std::nullopt);
+			auto head  = Signature(8, std::nullopt);
+			for (int i = 0; i < 8; i++)
+			{
+				tail.push_back(static_cast<std::uint8_t>(0xA0 + i));
+				head.push_back(static_cast<std::uint8_t>(0xB0 + i));
+			}
+			PlantSignature(small, tail, 0x2000 - 4); // starts inside the first range, fixed bytes past its end
+			PlantSignature(small, head, 0x3000 - 4); // starts before the second range, fixed bytes inside it
+
+			const auto scan = [&](std::size_t fillers) {
+				ScanEngine scanEngine(small);
+				scanEngine.SetRanges(SectionClass::CODE, {{0x1000, 0x2000}, {0x3000, 0x4000}});
+				scanEngine.Add(tail);
+				scanEngine.Add(head);
+				for (std::size_t i = 0; i < fillers; i++)
+					scanEngine.Add(CreateSignature(rng, 16));
+				return std::make_pair(scanEngine.Run(), scanEngine.RunAll());
+			};
+
+			const auto [direct, directAll]   = scan(0);
+			const auto [indexed, indexedAll] = scan(g_PatternCount);
+			Check(direct[0] == 0x2000 - 4 && !direct[1], "the direct scan matches by the first byte of a signature");
+			Check(indexed[0] == direct[0] && indexed[1] == direct[1], "the indexed scan agrees with the direct scan at range ends");
+			Check(indexedAll[0] == std::vector<std::size_t>{0x2000 - 4} && indexedAll[1].empty(), "RunAll follows the same range rule");
+		}
+	}
+}
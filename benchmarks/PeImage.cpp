@@ -0,0 +1,91 @@
+#include "Benchmark.hpp"
+#include "core/memory/PeImage.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace YimMenu::Benchmarks
+{
+	namespace
+	{
+		// fixtures/Minimal.exe, a PE32+ with file alignment 0x200 and section alignment 0x1000:
+		//   .text   RVA 0x1000 size 0x150 at 0x200, code, DE AD BE EF at RVA 0x1010
+		//   .rdata  RVA 0x2000 size 0x80  at 0x400, data, "data" at RVA 0x2004
+		//   .rsrc   RVA 0x3000 size 0x40  at 0x600, resources are never scanned
+		//   .reloc  RVA 0x4000 size 0x10  at 0x800, discardable
+		std::vector<std::uint8_t> ReadFixture()
+		{
+			std::ifstream file(TERMINUS_BENCHMARK_FIXTURES "/Minimal.exe", std::ios::binary);
+			return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+		}
+
+		// what the OS loader does with the file, every section copied to its RVA
+		std::vector<std::uint8_t> MapImage(std::span<const std::uint8_t> file, const PeImage& image)
+		{
+			std::vector<std::uint8_t> mapped(image.SizeOfImage());
+			std::memcpy(mapped.data(), file.data(), 0x200);
+			for (const auto& section : image.Sections())
+				std::memcpy(mapped.data() + section.m_VirtualAddress, file.data() + section.m_RawOffset, std::min(section.m_VirtualSize, section.m_RawSize));
+			return mapped;
+		}
+
+		bool RangesEqual(const std::vector<PeImage::Range>& ranges, std::initializer_list<PeImage::Range> expected)
+		{
+			return std::ranges::equal(ranges, expected, [](const PeImage::Range& a, const PeImage::Range& b) {
+				return a.m_Begin == b.m_Begin && a.m_End == b.m_End;
+			});
+		}
+	}
+
+	BENCHMARK(PeImage)
+	{
+		const auto file = ReadFixture();
+		Check(file.size() == 0xA00, "the fixture can be read");
+
+		const auto image = PeImage::Parse(file, PeLayout::FILE);
+		Check(image.has_value(), "the fixture parses");
+		if (!image)
+			return;
+
+		const auto& sections = image->Sections();
+		Check(sections.size() == 4 && sections[0].m_Name == ".text" && sections[3].m_Name == ".reloc", "all sections are read with their names");
+		Check(image->TimeDateStamp() == 0x5F5E1000 && image->CheckSum() == 0x1234 && image->SizeOfImage() == 0x5000 && image->SizeOfCode() == 0x200, "the header fields are read");
+
+		Check(sections[0].IsCode() && !sections[0].IsData(), ".text is code");
+		Check(sections[1].IsData() && !sections[1].IsCode(), ".rdata is data");
+		Check(!sections[2].IsData() && !sections[2].IsCode(), ".rsrc is neither");
+		Check(!sections[3].IsData() && !sections[3].IsCode(), "discardable .reloc is neither");
+
+		// on disk a section ends at the smaller of its virtual and raw size
+		Check(RangesEqual(image->Ranges(SectionClass::CODE), {{0x200, 0x350}}), "the code range of the file layout");
+		Check(RangesEqual(image->Ranges(SectionClass::DATA), {{0x400, 0x480}}), "the data range of the file layout");
+
+		Check(image->RvaToOffset(0x1010) == 0x210 && image->RvaToOffset(0x2004) == 0x404, "RVAs inside sections convert to file offsets");
+		Check(!image->RvaToOffset(0x100) && !image->RvaToOffset(0x5000), "RVAs outside of the sections have no file offset");
+		Check(image->OffsetToRva(0x210) == 0x1010 && image->OffsetToRva(0x404) == 0x2004, "file offsets inside sections convert to RVAs");
+		Check(!image->OffsetToRva(0x100) && !image->OffsetToRva(0xA00), "file offsets outside of the sections have no RVA");
+
+		const auto marker = image->RvaToOffset(0x1010);
+		Check(marker && *marker + 4 <= file.size() && std::memcmp(file.data() + *marker, "\xDE\xAD\xBE\xEF", 4) == 0, "RvaToOffset points at the bytes of the RVA");
+
+		const auto mapped      = MapImage(file, *image);
+		const auto mappedImage = PeImage::Parse(mapped, PeLayout::MAPPED);
+		Check(mappedImage.has_value(), "the mapped fixture parses");
+		if (mappedImage)
+		{
+			Check(RangesEqual(mappedImage->Ranges(SectionClass::CODE), {{0x1000, 0x1150}}), "the code range of the mapped layout");
+			Check(RangesEqual(mappedImage->Ranges(SectionClass::DATA), {{0x2000, 0x2080}}), "the data range of the mapped layout");
+			Check(mappedImage->RvaToOffset(0x1010) == 0x1010 && !mappedImage->RvaToOffset(0x5000), "mapped RVAs are offsets");
+		}
+
+		Check(!PeImage::Parse(std::span(file).first(0x1E0), PeLayout::FILE), "a truncated section table is rejected");
+		Check(!PeImage::Parse(std::span(file).subspan(1), PeLayout::FILE), "a buffer without the DOS header is rejected");
+
+		Report("parse", 100000, Measure(100000, [&] {
+			DoNotOptimize(PeImage::Parse(file, PeLayout::FILE));
+		}));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "Benchmark.hpp"
+#include "util/ProtobufStream.hpp"
+
+#include <random>
+
+namespace YimMenu::Benchmarks
+{
+	static void WriteVarInt(std::vector<std::uint8_t>& out, std::uint64_t value)
+	{
+		do
+		{
+			out.push_back(static_cast<std::uint8_t>((value & 0x7F) | (value > 0x7F ? 0x80 : 0)));
+			value >>= 7;
+		} while (value);
+	}
+
+	// presence messages look like this: a few scalar fields, strings and nested messages
+	static std::vector<std::uint8_t> CreateMessage(std::mt19937& rng, int depth)
+	{
+		std::vector<std::uint8_t> out;
+		std::uniform_int_distribution<std::uint64_t> value(0, 1ull << 40);
+
+		for (std::uint32_t field = 1; field <= 12; field++)
+		{
+			switch (field % 4)
+			{
+			case 0:
+				WriteVarInt(out, field << 3 | 0);
+				WriteVarInt(out, value(rng) >> (field * 3));
+				break;
+			case 1:
+				WriteVarInt(out, field << 3 | 5);
+				for (int i = 0; i < 4; i++)
+					out.push_back(static_cast<std::uint8_t>(rng()));
+				break;
+			case 2:
+			{
+				const std::string string = "gamer_handle_" + std::to_string(value(rng));
+				WriteVarInt(out, field << 3 | 2);
+				WriteVarInt(out, string.size());
+				out.insert(out.end(), string.begin(), string.end());
+				break;
+			}
+			case 3:
+				if (depth > 0)
+				{
+					const auto child = CreateMessage(rng, depth - 1);
+					WriteVarInt(out, field << 3 | 2);
+					WriteVarInt(out, child.size());
+					out.insert(out.end(), child.begin(), child.end());
+				}
+				break;
+			}
+		}
+		return out;
+	}
+
+	// the traversal PrintProtoBuffer does, minus the printing
+	static std::uint64_t Walk(ProtobufStream stream)
+	{
+		std::uint64_t checksum = 0;
+		while (!stream.IsEof())
+		{
+			const auto tag = stream.ReadVarInt();
+			if (!tag)
+				break;
+
+			switch (tag & 0b111)
+			{
+			case 0: checksum += stream.ReadVarInt(); break;
+			case 1: checksum += stream.ReadUInt64(); break;
+			case 5: checksum += stream.ReadUInt32(); break;
+			case 2:
+			{
+				const auto length = stream.ReadVarInt();
+				// odd fields are strings in CreateMessage, even ones nested messages
+				if ((tag >> 3) % 4 == 2)
+					checksum += stream.ReadString(length).size();
+				else
+					checksum += Walk(stream.ExtractSubMessage(length));
+				break;
+			}
+			default: return checksum;
+			}
+		}
+		return checksum;
+	}
+
+	BENCHMARK(ProtobufStream)
+	{
+		std::mt19937 rng(42);
+		auto message = CreateMessage(rng, 3);
+
+		Report("decode " + std::to_string(message.size()) + " byte message", 20000, Measure(20000, [&] {
+			DoNotOptimize(Walk(ProtobufStream(message.data(), message.size())));
+		}));
+
+		std::vector<std::uint8_t> varints;
+		std::uniform_int_distribution<std::uint64_t> value(0, UINT64_MAX);
+		for (int i = 0; i < 65536; i++)
+			WriteVarInt(varints, value(rng) >> (i % 64));
+
+		Report("65536 varints", 100, Measure(100, [&] {
+			ProtobufStream stream(varints.data(), varints.size());
+			std::uint64_t sum = 0;
+			while (!stream.IsEof())
+				sum += stream.ReadVarInt();
+			DoNotOptimize(sum);
+		}));
+	}
+}
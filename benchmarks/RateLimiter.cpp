@@ -0,0 +1,18 @@
+#include "Benchmark.hpp"
+#include "core/misc/RateLimiter.hpp"
+
+namespace YimMenu::Benchmarks
+{
+	BENCHMARK(RateLimiter)
+	{
+		// the protections call Process() once per received event, most of them within the period
+		RateLimiter limiter(std::chrono::seconds(1), 5);
+		Report("Process", 1000000, Measure(1000000, [&] {
+			DoNotOptimize(limiter.Process());
+		}));
+
+		Report("Process + ExceededLastProcess", 1000000, Measure(1000000, [&] {
+			DoNotOptimize(limiter.Process() && limiter.ExceededLastProcess());
+		}));
+	}
+}
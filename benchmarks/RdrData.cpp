@@ -0,0 +1,65 @@
+#include "Benchmark.hpp"
+#include "util/Joaat.hpp"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "game/rdr/data/MessageTypes.hpp"
+#include "game/rdr/data/PedModels.hpp"
+#include "game/rdr/data/ScriptNames.hpp"
+
+namespace YimMenu::Benchmarks
+{
+	// same linear search as Scripts::GetScriptName
+	static const char* GetScriptName(std::uint32_t hash)
+	{
+		for (std::size_t i = 0; i < Data::g_MpScriptNames.size(); i++)
+		{
+			if (Data::g_MpScriptNames[i].first == hash)
+				return Data::g_MpScriptNames[i].second;
+		}
+
+		for (std::size_t i = 0; i < Data::g_SpScriptNames.size(); i++)
+		{
+			if (Data::g_SpScriptNames[i].first == hash)
+				return Data::g_SpScriptNames[i].second;
+		}
+		return "Unknown";
+	}
+
+	BENCHMARK(RdrData)
+	{
+		std::vector<std::uint32_t> pedHashes;
+		for (const auto& [hash, name] : Data::g_PedModels)
+			pedHashes.push_back(hash);
+
+		Report("g_PedModels find (" + std::to_string(pedHashes.size()) + " hits)", 1000, Measure(1000, [&] {
+			std::size_t found = 0;
+			for (const auto hash : pedHashes)
+				found += Data::g_PedModels.find(hash) != Data::g_PedModels.end();
+			DoNotOptimize(found);
+		}));
+
+		std::vector<std::uint32_t> scriptHashes;
+		for (std::size_t i = 0; i < Data::g_SpScriptNames.size(); i += 16)
+			scriptHashes.push_back(Data::g_SpScriptNames[i].first);
+		scriptHashes.push_back("not_a_script"_J);
+
+		Report("GetScriptName (" + std::to_string(scriptHashes.size()) + " lookups)", 1000, Measure(1000, [&] {
+			std::size_t length = 0;
+			for (const auto hash : scriptHashes)
+				length += std::char_traits<char>::length(GetScriptName(hash));
+			DoNotOptimize(length);
+		}));
+
+		Report("g_MessageTypes find (256 ids)", 10000, Measure(10000, [&] {
+			std::size_t found = 0;
+			for (int id = 0; id < 256; id++)
+				found += Data::g_MessageTypes.contains(id);
+			DoNotOptimize(found);
+		}));
+	}
+}
@@ -0,0 +1,287 @@
+#include "Benchmark.hpp"
+#include "core/misc/Fiber.hpp"
+#include "game/backend/FiberPool.hpp"
+#include "game/backend/ScriptMgr.hpp"
+#include "core/misc/Task.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace YimMenu::Benchmarks
+{
+	namespace
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		/**
+		 * @brief Stands in for the RunScriptThreads hook, a fake clock that advances by one 60 FPS frame per tick
+		 */
+		class SimulatedGame
+		{
+		public:
+			static constexpr auto g_FrameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::microseconds(16667));
+
+			SimulatedGame()
+			{
+				ScriptMgr::Init();
+			}
+
+			~SimulatedGame()
+			{
+				FiberPool::Destroy();
+				ScriptMgr::Destroy();
+			}
+
+			void Tick()
+			{
+				m_Now += g_FrameTime;
+				m_Ticks++;
+				ScriptMgr::Tick(m_Now);
+			}
+
+			std::uint64_t GetTicks() const
+			{
+				return m_Ticks;
+			}
+
+		private:
+			Clock::time_point m_Now{}; // the same start every run, so wake ups land on the same ticks
+			std::uint64_t m_Ticks = 0;
+		};
+
+		Task<> Spin()
+		{
+			while (true)
+				co_await NextTick();
+		}
+
+		Task<int> SleepThenReturn(int value, std::chrono::milliseconds time)
+		{
+			co_await Sleep(time);
+			co_return value;
+		}
+
+		Task<> SleepAll(int count, std::uint64_t* ticks, SimulatedGame* game)
+		{
+			std::vector<Task<int>> tasks;
+			for (int i = 0; i < count; i++)
+				tasks.push_back(SleepThenReturn(i, std::chrono::milliseconds(25 + i % 4 * 25)));
+
+			const auto start = game->GetTicks();
+			const auto results = co_await WhenAll(std::move(tasks));
+			*ticks = game->GetTicks() - start;
+			DoNotOptimize(results);
+		}
+
+		Task<int> Immediately(int value)
+		{
+			co_return value;
+		}
+
+		Task<> Throw()
+		{
+			co_await NextTick();
+			throw std::runtime_error("task failed");
+		}
+
+		Task<> SleepAndRecord(std::chrono::milliseconds time, Clock::time_point* start, Clock::time_point* resumed)
+		{
+			*start = ScriptMgr::GetTickTime();
+			co_await Sleep(time);
+			*resumed = ScriptMgr::GetTickTime();
+		}
+
+		// the later a task is in the list the sooner it finishes, the results must still come back in list order
+		Task<> CollectReversed(int count, std::vector<int>* out)
+		{
+			std::vector<Task<int>> tasks;
+			for (int i = 0; i < count; i++)
+				tasks.push_back(SleepThenReturn(i, std::chrono::milliseconds((count - i) * 20)));
+			*out = co_await WhenAll(std::move(tasks));
+		}
+
+		Task<> CollectMixed(bool sleep, std::vector<int>* out, bool* done)
+		{
+			std::vector<Task<int>> tasks;
+			tasks.push_back(Immediately(0));
+			tasks.push_back(Immediately(1));
+			if (sleep)
+				tasks.push_back(SleepThenReturn(2, std::chrono::milliseconds(50)));
+			*out  = co_await WhenAll(std::move(tasks));
+			*done = true;
+		}
+	}
+
+	BENCHMARK(ScriptMgr)
+	{
+		// raw cost of switching into a fiber and back out
+		{
+			Fiber fiber([] {
+				while (true)
+					Fiber::Suspend();
+			});
+			Report("fiber resume + suspend", 1000000, Measure(1000000, [&] {
+				fiber.Resume();
+			}));
+		}
+
+		// overhead of the scheduler itself with scripts that yield right away
+		{
+			SimulatedGame game;
+			for (int i = 0; i < 100; i++)
+				ScriptMgr::AddScript(std::make_unique<Script>([] {
+					while (true)
+						ScriptMgr::Yield();
+				}));
+			game.Tick();
+			Report("tick, 100 scripts yielding", 10000, Measure(10000, [&] {
+				game.Tick();
+			}));
+		}
+
+		// how many ticks a Yield(25ms) actually sleeps, 25ms is a frame and a half so two ticks is the best possible
+		{
+			SimulatedGame game;
+			std::vector<std::uint64_t> gaps;
+			for (int i = 0; i < 100; i++)
+				ScriptMgr::AddScript(std::make_unique<Script>([&] {
+					auto last = game.GetTicks();
+					while (true)
+					{
+						ScriptMgr::Yield(std::chrono::milliseconds(25));
+						gaps.push_back(game.GetTicks() - last);
+						last = game.GetTicks();
+					}
+				}));
+
+			const auto timing = Measure(1000, [&] {
+				game.Tick();
+			});
+
+			std::uint64_t total = 0, worst = 0;
+			for (const auto gap : gaps)
+			{
+				total += gap;
+				worst = std::max(worst, gap);
+			}
+			Report("latency, 100 scripts Yield(25ms): avg " + std::to_string(static_cast<double>(total) / gaps.size()) + " ticks, max " + std::to_string(worst) + " ticks", 1000, timing);
+		}
+
+		// jobs the five pool fibers get through, without and with the default budget of a tick
+		for (const auto budget : {std::chrono::microseconds(std::chrono::hours(1)), std::chrono::microseconds(2000)})
+		{
+			SimulatedGame game;
+			FiberPool::Init(5);
+			FiberPool::SetTickBudget(budget);
+
+			constexpr int jobs = 100000;
+			int done           = 0;
+			const auto timing  = Measure(1, [&] {
+				for (int i = 0; i < jobs; i++)
+					FiberPool::Push([&done] {
+						done++;
+					});
+				while (done < jobs)
+					game.Tick();
+			});
+			Report("fiber pool, " + std::to_string(jobs) + " jobs, " + (budget == std::chrono::hours(1) ? std::string("no") : std::to_string(budget.count()) + " us") + " budget: " + std::to_string(game.GetTicks()) + " ticks", jobs, timing);
+		}
+	}
+
+	BENCHMARK(Tasks)
+	{
+		// the same in flight operations as script fibers and as coroutines, a fiber costs a whole stack each
+		for (const int count : {100, 1000})
+		{
+			SimulatedGame game;
+			for (int i = 0; i < count; i++)
+				ScriptMgr::AddScript(std::make_unique<Script>([] {
+					while (true)
+						ScriptMgr::Yield();
+				}));
+			game.Tick();
+			Report("tick, " + std::to_string(count) + " fibers yielding", 1000, Measure(1000, [&] {
+				game.Tick();
+			}));
+		}
+
+		for (const int count : {100, 1000})
+		{
+			SimulatedGame game;
+			for (int i = 0; i < count; i++)
+				ScriptMgr::Spawn(Spin());
+			game.Tick();
+			Report("tick, " + std::to_string(count) + " tasks awaiting NextTick()", 1000, Measure(1000, [&] {
+				game.Tick();
+			}));
+		}
+
+		// WhenAll() over sleeps of 25 to 100ms finishes on the tick the longest sleep is due
+		{
+			SimulatedGame game;
+			std::uint64_t ticks = 0;
+			ScriptMgr::Spawn(SleepAll(1000, &ticks, &game));
+			const auto timing = Measure(10, [&] {
+				game.Tick();
+			});
+			Report("WhenAll, 1000 tasks sleeping up to 100ms: " + std::to_string(ticks) + " ticks", 10, timing);
+		}
+
+		{
+			SimulatedGame game;
+			std::vector<int> results;
+			ScriptMgr::Spawn(CollectReversed(8, &results));
+			for (int i = 0; i < 20; i++)
+				game.Tick();
+			Check(results == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}, "WhenAll returns the results in task order, not in the order the tasks finished");
+		}
+
+		{
+			SimulatedGame game;
+			int failures = 0;
+			ScriptMgr::SetTaskErrorHandler([&failures](std::exception_ptr) {
+				failures++;
+			});
+			ScriptMgr::Spawn(Throw());
+			for (int i = 0; i < 5; i++)
+				game.Tick();
+			ScriptMgr::SetTaskErrorHandler(nullptr);
+			Check(failures == 1, "a task that throws reaches the error handler exactly once");
+		}
+
+		{
+			SimulatedGame game;
+			Clock::time_point start{}, resumed{};
+			ScriptMgr::Spawn(SleepAndRecord(std::chrono::milliseconds(50), &start, &resumed));
+			for (int i = 0; i < 10; i++)
+				game.Tick();
+			Check(resumed - start >= std::chrono::milliseconds(50), "Sleep(50ms) does not resume before 50ms passed");
+			Check(resumed - start < std::chrono::milliseconds(50) + SimulatedGame::g_FrameTime, "Sleep(50ms) resumes on the first tick at or after 50ms");
+		}
+
+		// tasks that finish while WhenAll() starts them must not resume the waiter before it suspended
+		{
+			SimulatedGame game;
+			std::vector<int> results;
+			bool done = false;
+			ScriptMgr::Spawn(CollectMixed(true, &results, &done));
+			game.Tick();
+			Check(!done, "WhenAll waits for the sleeping task even if the others finished right away");
+			for (int i = 0; i < 5; i++)
+				game.Tick();
+			Check(done && results == std::vector<int>{0, 1, 2}, "WhenAll finishes once the sleeping task did");
+		}
+
+		{
+			SimulatedGame game;
+			std::vector<int> results;
+			bool done = false;
+			ScriptMgr::Spawn(CollectMixed(false, &results, &done));
+			game.Tick();
+			Check(done && results == std::vector<int>{0, 1}, "WhenAll over tasks that all finish right away completes on the same tick");
+		}
+	}
+}
\ No newline at end of file
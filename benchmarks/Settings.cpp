@@ -0,0 +1,150 @@
+#ifdef TERMINUS_BENCHMARK_JSON
+#include "Benchmark.hpp"
+#include "core/settings/SettingsSnapshot.hpp"
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace YimMenu::Benchmarks
+{
+	// stand-in for the registered commands, the real ones register themselves with the game-side singletons
+	using CommandState = std::variant<bool, int, float, std::array<float, 3>>;
+
+	static std::vector<std::pair<std::string, CommandState>> CreateCommands(std::size_t count)
+	{
+		std::vector<std::pair<std::string, CommandState>> commands;
+		for (std::size_t i = 0; i < count; i++)
+		{
+			auto name = "command" + std::to_string(i);
+			switch (i % 8)
+			{
+			case 0: commands.emplace_back(std::move(name), static_cast<int>(i)); break;
+			case 1: commands.emplace_back(std::move(name), i * 0.25f); break;
+			case 2: commands.emplace_back(std::move(name), std::array<float, 3>{1.0f, 2.0f, 3.0f}); break;
+			default: commands.emplace_back(std::move(name), i % 2 == 0); break;
+			}
+		}
+		return commands;
+	}
+
+	// same shape as Commands::SaveStateImpl followed by the dump in Settings::TickImpl
+	static std::string Save(const std::vector<std::pair<std::string, CommandState>>& commands, nlohmann::json& document)
+	{
+		auto& state = document["commands"];
+		for (const auto& [name, value] : commands)
+		{
+			if (!state.contains(name))
+				state[name] = nlohmann::json::object();
+
+			std::visit(
+			    [&](const auto& v) {
+				    state[name] = v;
+			    },
+			    value);
+		}
+		return document.dump(4);
+	}
+
+	static void Load(std::vector<std::pair<std::string, CommandState>>& commands, const std::string& text)
+	{
+		auto document = nlohmann::json::parse(text);
+		auto& state   = document["commands"];
+		for (auto& [name, value] : commands)
+		{
+			if (!state.contains(name))
+				continue;
+
+			std::visit(
+			    [&](auto& v) {
+				    v = state[name].get<std::remove_reference_t<decltype(v)>>();
+			    },
+			    value);
+		}
+	}
+
+	// a FloatCommand slider dragged for one second marks the commands dirty once per frame
+	static constexpr int g_DragFrames = 60;
+
+	static void SimulateDragFull(std::vector<std::pair<std::string, CommandState>>& commands, nlohmann::json& document, std::size_t& bytesWritten)
+	{
+		// every change re-serialized all commands and rewrote the file
+		for (int frame = 0; frame < g_DragFrames; frame++)
+		{
+			std::get<float>(commands[1].second) = frame * 0.1f;
+			bytesWritten += Save(commands, document).size();
+		}
+	}
+
+	static void SimulateDragIncremental(std::vector<std::pair<std::string, CommandState>>& commands, nlohmann::json& document, std::size_t& bytesWritten)
+	{
+		// only the dragged command is re-serialized into the cached document, the burst is coalesced into a single write
+		auto& state = document["commands"];
+		for (int frame = 0; frame < g_DragFrames; frame++)
+		{
+			auto& value = std::get<float>(commands[1].second);
+			value       = frame * 0.1f;
+			state[commands[1].first] = value;
+		}
+		bytesWritten += document.dump(4).size();
+	}
+
+	BENCHMARK(Settings)
+	{
+		auto commands = CreateCommands(400);
+		nlohmann::json document = nlohmann::json::object();
+		document["hotkeys"]     = nlohmann::json::object();
+		for (int i = 0; i < 32; i++)
+			document["hotkeys"]["command" + std::to_string(i)] = {0x11, 0x41 + i};
+
+		std::string text;
+		Report("save 400 commands + dump", 1000, Measure(1000, [&] {
+			text = Save(commands, document);
+			DoNotOptimize(text.size());
+		}));
+
+		Report("parse + load " + std::to_string(text.size()) + " bytes", 1000, Measure(1000, [&] {
+			Load(commands, text);
+			DoNotOptimize(commands.size());
+		}));
+
+		// startup: the whole file from disk into a document, both ways
+		const auto directory = std::filesystem::temp_directory_path();
+		const auto jsonFile  = directory / "terminus_benchmark_settings.json";
+		const auto snapshot  = directory / "terminus_benchmark_settings.bin";
+		std::ofstream(jsonFile, std::ios::trunc) << text;
+		SettingsSnapshot::Write(snapshot, jsonFile, SettingsSnapshot::Encode(nlohmann::json::parse(text)));
+
+		Report("startup load, settings.json", 1000, Measure(1000, [&] {
+			std::ifstream file(jsonFile);
+			nlohmann::json json;
+			file >> json;
+			DoNotOptimize(json.size());
+		}));
+
+		Report("startup load, snapshot (" + std::to_string(std::filesystem::file_size(snapshot)) + " bytes)", 1000, Measure(1000, [&] {
+			const auto json = SettingsSnapshot::Read(snapshot, jsonFile);
+			DoNotOptimize(json->size());
+		}));
+
+		std::filesystem::remove(jsonFile);
+		std::filesystem::remove(snapshot);
+
+		std::size_t bytesWritten = 0;
+		const auto full = Measure(10, [&] {
+			SimulateDragFull(commands, document, bytesWritten);
+		});
+		Report("slider drag, full rewrites (" + std::to_string(bytesWritten / 10 / 1024) + " KiB per drag)", 10, full);
+
+		bytesWritten = 0;
+		const auto incremental = Measure(10, [&] {
+			SimulateDragIncremental(commands, document, bytesWritten);
+		});
+		Report("slider drag, incremental (" + std::to_string(bytesWritten / 10 / 1024) + " KiB per drag)", 10, incremental);
+	}
+}
+#endif
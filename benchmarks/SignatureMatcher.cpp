@@ -0,0 +1,90 @@
+#include "Benchmark.hpp"
+#include "SyntheticImage.hpp"
+#include "core/memory/Pattern.hpp"
+#include "core/memory/SignatureMatcher.hpp"
+
+#include <iostream>
+#include <string>
+
+namespace YimMenu::Benchmarks
+{
+	static constexpr std::size_t g_BlobSize = 32 * 1024 * 1024;
+
+	// a few real signatures from Pointers.cpp, compiled by Pattern<S>
+	static const Pattern<"48 8B 58 60 48 8B 0D"> g_SwapChain("IDXGISwapChain1");
+	static const Pattern<"E8 ? ? ? ? 38 58 09"> g_GetRendererInfo("GetRendererInfo");
+	static const Pattern<"48 89 5C 24 ? 4C 89 4C 24 ? 48 89 4C 24 ? 55 56 57 41 54 41 55 41 56 41 57 48 8B EC 48 83 EC 60"> g_WndProc("WndProc");
+	static const Pattern<"41 8D 49 0D"> g_KeyboardHook("KeyboardHook");
+	static const Pattern<"B8 81 00 20 00 85 FF"> g_CanCreateNetworkObject("CanCreateNetworkObject");
+
+	static std::optional<std::size_t> OptionalScan(std::span<const std::uint8_t> image, std::span<const std::optional<std::uint8_t>> signature)
+	{
+		for (std::size_t i = 0; i + signature.size() <= image.size(); ++i)
+		{
+			bool found = true;
+			for (std::size_t j = 0; j < signature.size(); ++j)
+			{
+				if (signature[j] && signature[j].value() != image[i + j])
+				{
+					found = false;
+				}
+			}
+
+			if (found)
+				return i;
+		}
+		return std::nullopt;
+	}
+
+	static void RunBlob(std::string_view blobName, std::vector<std::uint8_t> blob)
+	{
+		const IPattern* patterns[] = {&g_SwapChain, &g_GetRendererInfo, &g_WndProc, &g_KeyboardHook, &g_CanCreateNetworkObject};
+
+		// plant every pattern close to the end so each scan walks (almost) the whole blob
+		for (std::size_t i = 0; i < std::size(patterns); i++)
+		{
+			const auto signature = patterns[i]->Signature();
+			PlantSignature(blob, Signature(signature.begin(), signature.end()), blob.size() - 256 * (i + 1));
+		}
+
+		const auto run = [&](std::string_view name, auto&& find) {
+			std::vector<std::optional<std::size_t>> results;
+			const auto timing = Measure(1, [&] {
+				for (const auto pattern : patterns)
+					results.push_back(find(pattern));
+			});
+			Report(std::string(blobName) + " " + std::string(name), std::size(patterns), timing);
+			return results;
+		};
+
+		const auto reference = run("optional<uint8_t> loop", [&](const IPattern* pattern) {
+			return OptionalScan(blob, pattern->Signature());
+		});
+
+		const std::pair<std::string_view, MatcherBackend> backends[] = {{"scalar", MatcherBackend::SCALAR}, {"sse2", MatcherBackend::SSE2}, {"avx2", MatcherBackend::AVX2}};
+		for (const auto& [name, backend] : backends)
+		{
+			if (backend > SignatureMatcher::GetBestBackend())
+				continue;
+
+			const auto results = run(name, [&](const IPattern* pattern) {
+				return SignatureMatcher::FindFirst(blob, pattern->Packed(), backend);
+			});
+
+			if (results != reference)
+				std::cerr << "SignatureMatcher: " << name << " results differ from the reference scanner!" << std::endl;
+		}
+	}
+
+	BENCHMARK(SignatureMatcher)
+	{
+		std::vector<std::uint8_t> random(g_BlobSize);
+		std::mt19937 rng(7);
+		std::uniform_int_distribution<int> any(0, 0xFF);
+		for (auto& byte : random)
+			byte = static_cast<std::uint8_t>(any(rng));
+
+		RunBlob("random", std::move(random));
+		RunBlob("x86", CreateCodeImage(g_BlobSize));
+	}
+}
@@ -0,0 +1,112 @@
+#include "Benchmark.hpp"
+#include "game/backend/SyncNodeDumper.hpp"
+
+#include <sstream>
+
+namespace YimMenu::Benchmarks
+{
+	namespace
+	{
+		struct Vector3
+		{
+			float x, y, z;
+		};
+
+		struct Vector4
+		{
+			float x, y, z, w;
+		};
+
+		// shaped like CPhysicalAttachData, a typical node of a handful of fields
+		struct AttachData
+		{
+			bool m_IsAttached;
+			std::uint16_t m_AttachObjectId;
+			Vector3 m_Offset;
+			Vector4 m_Orientation;
+			Vector3 m_ParentOffset;
+			std::uint16_t m_OtherAttachBone;
+			std::uint16_t m_AttachBone;
+			std::uint32_t m_AttachFlags;
+			std::uint32_t m_ModelHash;
+		};
+
+		constexpr SyncField g_AttachFields[] = {
+		    SYNC_FIELD(AttachData, m_IsAttached),
+		    SYNC_FIELD(AttachData, m_AttachObjectId),
+		    SYNC_FIELD(AttachData, m_Offset),
+		    SYNC_FIELD(AttachData, m_Orientation),
+		    SYNC_FIELD(AttachData, m_ParentOffset),
+		    SYNC_FIELD(AttachData, m_OtherAttachBone),
+		    SYNC_FIELD(AttachData, m_AttachBone),
+		    SYNC_FIELD(AttachData, m_AttachFlags),
+		    SYNC_FIELD_H(AttachData, m_ModelHash),
+		};
+
+		constexpr SyncNodeLayout g_AttachLayout{0x1234, g_AttachFields, nullptr, GetSyncFieldsExtent(g_AttachFields)};
+	}
+
+	BENCHMARK(SyncNodeDumper)
+	{
+		const AttachData data{true, 42, {1.5f, -2.25f, 3.0f}, {0.0f, 0.0f, 0.7071f, 0.7071f}, {0.0f, 0.5f, 1.0f}, 3, 7, 0x11, 0xDEADBEEF};
+		constexpr int iterations = 200000;
+
+		// what the old per field LOG() lines paid for the stream work alone, one record per field
+		Report("stream per field", iterations, Measure(iterations, [&] {
+			std::ostringstream line;
+			line << "\tm_IsAttached: " << (data.m_IsAttached ? "YES" : "NO");
+			DoNotOptimize(line.str());
+			line.str({});
+			line << "\tm_AttachObjectId: " << data.m_AttachObjectId;
+			DoNotOptimize(line.str());
+			line.str({});
+			line << "\tm_Offset: X: " << data.m_Offset.x << " Y: " << data.m_Offset.y << " Z: " << data.m_Offset.z;
+			DoNotOptimize(line.str());
+			line.str({});
+			line << "\tm_Orientation: X: " << data.m_Orientation.x << " Y: " << data.m_Orientation.y << " Z: " << data.m_Orientation.z << " W: " << data.m_Orientation.w;
+			DoNotOptimize(line.str());
+			line.str({});
+			line << "\tm_ParentOffset: X: " << data.m_ParentOffset.x << " Y: " << data.m_ParentOffset.y << " Z: " << data.m_ParentOffset.z;
+			DoNotOptimize(line.str());
+			line.str({});
+			line << "\tm_OtherAttachBone: " << data.m_OtherAttachBone;
+			DoNotOptimize(line.str());
+			line.str({});
+			line << "\tm_AttachBone: " << data.m_AttachBone;
+			DoNotOptimize(line.str());
+			line.str({});
+			line << "\tm_AttachFlags: " << data.m_AttachFlags;
+			DoNotOptimize(line.str());
+			line.str({});
+			line << "\tm_ModelHash: " << std::hex << std::uppercase << data.m_ModelHash;
+			DoNotOptimize(line.str());
+		}));
+
+		std::string record;
+		Report("table, one record", iterations, Measure(iterations, [&] {
+			record.clear();
+			SyncNodeDumper::Format(record, g_AttachLayout, reinterpret_cast<const std::uint8_t*>(&data));
+			DoNotOptimize(record.data());
+		}));
+
+		SyncNodeDumper::CaptureHeader header{0, g_AttachLayout.m_Id, 42, g_AttachLayout.m_Size, 0, 0xFF, 0};
+		Report("binary capture", iterations, Measure(iterations, [&] {
+			SyncNodeDumper::Capture(header, reinterpret_cast<const std::uint8_t*>(&data));
+		}));
+
+		const auto capture = SyncNodeDumper::GetCapture();
+		std::size_t captured = 0;
+		SyncNodeDumper::ForEachCaptured(capture, [&](const SyncNodeDumper::CaptureHeader&, const std::uint8_t*) {
+			captured++;
+		});
+		Report("decode capture (" + std::to_string(captured) + " nodes)", 1, Measure(1, [&] {
+			SyncNodeDumper::ForEachCaptured(capture, [&](const SyncNodeDumper::CaptureHeader&, const std::uint8_t* node) {
+				record.clear();
+				SyncNodeDumper::Format(record, g_AttachLayout, node);
+				DoNotOptimize(record.data());
+			});
+		}));
+
+		SyncNodeDumper::ClearCapture();
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace YimMenu::Benchmarks
+{
+	using Signature = std::vector<std::optional<std::uint8_t>>;
+
+	/**
+	 * @brief Fills a buffer with bytes following a rough x64 code distribution (REX prefixes, movs, calls, int3 padding)
+	 */
+	inline std::vector<std::uint8_t> CreateCodeImage(std::size_t size, std::uint32_t seed = 1337)
+	{
+		static constexpr std::uint8_t common[] = {0x48, 0x8B, 0x89, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x4C, 0x8D, 0x24, 0x44, 0x85, 0xC0, 0x0F, 0x74, 0x75, 0x83, 0xC4, 0x33, 0xC3, 0xCC, 0x41, 0x45, 0x5C, 0x20, 0x10, 0x08};
+
+		std::mt19937 rng(seed);
+		std::uniform_int_distribution<int> pick(0, sizeof(common) - 1);
+		std::uniform_int_distribution<int> any(0, 0xFF);
+		std::bernoulli_distribution useCommon(0.6);
+
+		std::vector<std::uint8_t> image(size);
+		for (auto& byte : image)
+			byte = static_cast<std::uint8_t>(useCommon(rng) ? common[pick(rng)] : any(rng));
+		return image;
+	}
+
+	/**
+	 * @brief Creates a signature that resembles the ones in Pointers.cpp, rel32 operands are wildcarded
+	 */
+	inline Signature CreateSignature(std::mt19937& rng, std::size_t length)
+	{
+		std::uniform_int_distribution<int> any(0, 0xFF);
+		std::bernoulli_distribution rel32(0.1);
+
+		Signature signature;
+		while (signature.size() < length)
+		{
+			if (signature.size() > 1 && signature.size() + 5 < length && rel32(rng))
+			{
+				signature.insert(signature.end(), {0xE8, std::nullopt, std::nullopt, std::nullopt, std::nullopt});
+				continue;
+			}
+			signature.push_back(static_cast<std::uint8_t>(any(rng)));
+		}
+		return signature;
+	}
+
+	/**
+	 * @brief Writes the fixed bytes of a signature into the image, wildcards keep the original bytes
+	 */
+	inline void PlantSignature(std::vector<std::uint8_t>& image, const Signature& signature, std::size_t offset)
+	{
+		for (std::size_t i = 0; i < signature.size(); i++)
+		{
+			if (signature[i])
+				image[offset + i] = *signature[i];
+		}
+	}
+}
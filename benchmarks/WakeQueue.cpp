@@ -0,0 +1,116 @@
+#include "Benchmark.hpp"
+#include "core/misc/WakeQueue.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace YimMenu::Benchmarks
+{
+	namespace
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		struct FakeScript
+		{
+			std::optional<Clock::time_point> m_WakeTime;
+			std::uint64_t m_Runs = 0;
+			std::size_t m_Id     = 0;
+		};
+	}
+
+	BENCHMARK(WakeQueue)
+	{
+		// a handful of scripts that run every tick next to a growing number that sleep for seconds
+		constexpr int runnable = 10;
+		constexpr int ticks    = 10000;
+
+		for (const int sleeping : {10, 100, 1000})
+		{
+			std::vector<FakeScript> scripts(runnable + sleeping);
+			const auto far = Clock::now() + std::chrono::hours(1);
+			for (std::size_t i = runnable; i < scripts.size(); i++)
+				scripts[i].m_WakeTime = far;
+
+			// what ScriptMgr did before, a clock read and compare for every script
+			Report("scan, " + std::to_string(sleeping) + " sleeping", ticks, Measure(ticks, [&] {
+				for (auto& script : scripts)
+				{
+					if (!script.m_WakeTime.has_value() || script.m_WakeTime.value() <= Clock::now())
+						script.m_Runs++;
+				}
+			}));
+
+			WakeQueue<FakeScript, Clock> queue;
+			for (auto& script : scripts)
+				queue.Add(&script);
+			queue.Tick(Clock::now(), [](FakeScript* script) {
+				return script->m_WakeTime;
+			});
+
+			Report("heap, " + std::to_string(sleeping) + " sleeping", ticks, Measure(ticks, [&] {
+				queue.Tick(Clock::now(), [](FakeScript* script) {
+					script->m_Runs++;
+					return script->m_WakeTime;
+				});
+			}));
+		}
+
+		// a script that sleeps briefly every tick, like the Yield(25ms) loops of the teleports
+		{
+			WakeQueue<FakeScript, Clock> queue;
+			std::vector<FakeScript> scripts(100);
+			for (auto& script : scripts)
+				queue.Add(&script);
+			auto now = Clock::now();
+			Report("heap, 100 scripts sleeping one tick each", ticks, Measure(ticks, [&] {
+				now += std::chrono::milliseconds(16);
+				queue.Tick(now, [&](FakeScript* script) {
+					script->m_Runs++;
+					return std::optional(now + std::chrono::milliseconds(10));
+				});
+			}));
+		}
+
+		// items woken from the heap, items that never slept and items added during a tick still run in the order
+		// they were added, and an item that returns TimePoint::max() never runs again
+		{
+			WakeQueue<FakeScript, Clock> queue;
+			std::vector<FakeScript> scripts(17);
+			for (std::size_t i = 0; i < scripts.size(); i++)
+				scripts[i].m_Id = i;
+			for (std::size_t i = 0; i < 16; i++)
+				queue.Add(&scripts[i]);
+
+			constexpr std::size_t dropped = 5;
+			auto now                      = Clock::time_point{};
+			bool ordered                  = true;
+			for (int tick = 0; tick < 200; tick++)
+			{
+				now += std::chrono::milliseconds(16);
+				std::optional<std::size_t> last;
+				queue.Tick(now, [&](FakeScript* script) -> std::optional<Clock::time_point> {
+					ordered = ordered && (!last || *last < script->m_Id);
+					last    = script->m_Id;
+					script->m_Runs++;
+
+					if (tick == 50 && script->m_Id == 0)
+						queue.Add(&scripts[16]);
+					if (script->m_Id == dropped && script->m_Runs == 3)
+						return Clock::time_point::max();
+					if (script->m_Id % 3 == 0)
+						return std::nullopt;
+					return now + std::chrono::milliseconds((script->m_Id * 7 + tick) % 5 * 10);
+				});
+			}
+
+			Check(ordered, "items run in the order they were added after mixed sleeps and wake ups");
+			Check(std::ranges::all_of(scripts, [](const FakeScript& script) {
+				return script.m_Runs > 0;
+			}), "every item runs, including the one added during a tick");
+			Check(scripts[dropped].m_Runs == 3, "an item that returns TimePoint::max() is dropped");
+			Check(queue.GetRunnableCount() + queue.GetSleepingCount() == scripts.size() - 1, "the dropped item is neither runnable nor sleeping");
+		}
+	}
+}
@@ -0,0 +1,92 @@
+#include "Benchmark.hpp"
+#include "core/misc/WorkerPool.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace YimMenu::Benchmarks
+{
+	namespace
+	{
+		// about the size of a player database with a few thousand entries
+		std::string MakeDocument(int entries)
+		{
+			std::string document = "{\n";
+			for (int i = 0; i < entries; i++)
+				document += "    \"" + std::to_string(76561198000000000 + i) + "\": {\"name\": \"player" + std::to_string(i) + "\", \"is_modder\": false, \"notes\": \"\"},\n";
+			document += "}\n";
+			return document;
+		}
+	}
+
+	BENCHMARK(WorkerPool)
+	{
+		const auto directory = std::filesystem::temp_directory_path() / "terminus_worker_pool";
+		std::filesystem::create_directories(directory);
+		const auto path     = directory / "database.json";
+		const auto document = MakeDocument(5000);
+
+		// what the game thread paid for every save before
+		Report("save on the caller, " + std::to_string(document.size() / 1024) + " KiB", 100, Measure(100, [&] {
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file << document;
+		}));
+
+		WorkerPool::Init(2);
+
+		// what it pays now, the write itself happens on a worker
+		Timing queued{};
+		for (int i = 0; i < 100; i++)
+		{
+			const auto timing = Measure(1, [&] {
+				WorkerPool::WriteFile(path, [&document] {
+					return document;
+				});
+			});
+			queued.m_WallMs += timing.m_WallMs;
+			queued.m_CpuMs += timing.m_CpuMs;
+
+			while (WorkerPool::IsFilePending(path))
+				std::this_thread::yield();
+		}
+		Report("WriteFile() on the caller", 100, queued);
+
+		// a player joining saves the database once per new player, a full lobby is a burst of them
+		const auto before = WorkerPool::GetStats();
+		const auto timing = Measure(1, [&] {
+			for (int i = 0; i < 32; i++)
+				WorkerPool::WriteFile(path, [&document] {
+					return document;
+				});
+			while (WorkerPool::IsFilePending(path))
+				std::this_thread::yield();
+		});
+		const auto after = WorkerPool::GetStats();
+		Report("burst of 32 saves: " + std::to_string(after.m_FileWrites - before.m_FileWrites) + " writes", 32, timing);
+
+		// round trip of a job and its completion, the completions are run like ScriptMgr does every tick
+		std::atomic<int> done = 0;
+		int completed         = 0;
+		Report("push + completion", 100000, Measure(1, [&] {
+			for (int i = 0; i < 100000; i++)
+				WorkerPool::Push(
+				    [&done] {
+					    return done.fetch_add(1) + 1;
+				    },
+				    [&completed](int) {
+					    completed++;
+				    });
+			while (completed < 100000)
+				WorkerPool::RunCompletions();
+		}));
+
+		const auto stats = WorkerPool::GetStats();
+		Report("backpressure: " + std::to_string(stats.m_Stalls) + " stalled pushes", 1, {});
+
+		WorkerPool::Destroy();
+		std::filesystem::remove_all(directory);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+message(STATUS "Setting up benchmarks")
+
+# numbers from an unoptimized build are meaningless
+if(NOT CMAKE_BUILD_TYPE AND NOT CMAKE_CONFIGURATION_TYPES)
+    set(CMAKE_BUILD_TYPE Release CACHE STRING "Build type" FORCE)
+endif()
+
+set(BENCHMARK_DIR "${PROJECT_SOURCE_DIR}/benchmarks")
+file(GLOB BENCHMARK_FILES
+    "${BENCHMARK_DIR}/*.hpp"
+    "${BENCHMARK_DIR}/*.cpp"
+)
+
+# portable sources from the main tree, these must not depend on common.hpp
+set(BENCHMARK_SRC_FILES
+    "${SRC_DIR}/core/commands/HotkeyMatcher.cpp"
+    "${SRC_DIR}/core/logger/LogLimiter.cpp"
+    "${SRC_DIR}/core/misc/Fiber.cpp"
+    "${SRC_DIR}/core/misc/FlightRecorder.cpp"
+    "${SRC_DIR}/core/misc/TickProfiler.cpp"
+    "${SRC_DIR}/core/misc/WorkerPool.cpp"
+    "${SRC_DIR}/core/memory/PeImage.cpp"
+    "${SRC_DIR}/core/memory/ScanEngine.cpp"
+    "${SRC_DIR}/core/memory/SignatureMatcher.cpp"
+    "${SRC_DIR}/game/backend/FiberPool.cpp"
+    "${SRC_DIR}/game/backend/ScriptMgr.cpp"
+    "${SRC_DIR}/game/backend/SyncNodeDumper.cpp"
+)
+
+find_package(Threads REQUIRED)
+
+# the settings benchmark needs nlohmann_json, the Windows build fetches it but it may be installed here as well
+if(NOT TARGET nlohmann_json::nlohmann_json)
+    find_package(nlohmann_json 3 QUIET)
+endif()
+
+add_executable(TerminusBenchmarks ${BENCHMARK_FILES} ${BENCHMARK_SRC_FILES})
+set_property(TARGET TerminusBenchmarks PROPERTY CXX_STANDARD 23)
+target_include_directories(TerminusBenchmarks PRIVATE "${SRC_DIR}" "${BENCHMARK_DIR}")
+target_compile_definitions(TerminusBenchmarks PRIVATE TERMINUS_BENCHMARK_FIXTURES="${BENCHMARK_DIR}/fixtures")
+target_link_libraries(TerminusBenchmarks PRIVATE Threads::Threads)
+
+if(TARGET nlohmann_json::nlohmann_json)
+    target_sources(TerminusBenchmarks PRIVATE "${SRC_DIR}/core/settings/SettingsSnapshot.cpp")
+    target_link_libraries(TerminusBenchmarks PRIVATE nlohmann_json::nlohmann_json)
+    target_compile_definitions(TerminusBenchmarks PRIVATE TERMINUS_BENCHMARK_JSON)
+else()
+    message(STATUS "nlohmann_json not found, skipping the settings benchmark")
+endif()
@@ -0,0 +1,22 @@
+message(STATUS "Setting up tools")
+
+set(TOOLS_DIR "${PROJECT_SOURCE_DIR}/tools")
+
+add_executable(TerminusSigScan
+    "${TOOLS_DIR}/SigScan.cpp"
+    "${SRC_DIR}/core/backend/PatternCache.cpp"
+    "${SRC_DIR}/core/memory/PeImage.cpp"
+    "${SRC_DIR}/core/memory/ScanEngine.cpp"
+    "${SRC_DIR}/core/memory/SignatureAnalyzer.cpp"
+    "${SRC_DIR}/core/memory/SignatureMatcher.cpp"
+)
+set_property(TARGET TerminusSigScan PROPERTY CXX_STANDARD 23)
+target_include_directories(TerminusSigScan PRIVATE "${SRC_DIR}")
+find_package(Threads REQUIRED)
+target_link_libraries(TerminusSigScan PRIVATE Threads::Threads)
+
+add_executable(TerminusFlightDecode
+    "${TOOLS_DIR}/FlightDecode.cpp"
+)
+set_property(TARGET TerminusFlightDecode PROPERTY CXX_STANDARD 23)
+target_include_directories(TerminusFlightDecode PRIVATE "${SRC_DIR}")
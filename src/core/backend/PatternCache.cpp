@@ -1,9 +1,33 @@
 #include "PatternCache.hpp"
-#include "core/filemgr/FileMgr.hpp"
+#include "util/Crc32.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
 
 namespace YimMenu
 {
-	std::optional<int> PatternCache::GetCachedOffsetImpl(PatternHash hash)
+#pragma pack(push, 1)
+	struct PatternCacheHeader
+	{
+		std::uint32_t m_Magic;
+		std::uint32_t m_Version;
+		std::uint64_t m_ModuleSize;
+		std::uint32_t m_TimeDateStamp;
+		std::uint32_t m_CheckSum;
+		std::uint32_t m_RecordCount;
+		std::uint32_t m_RecordCrc;
+	};
+
+	struct PatternCacheRecord
+	{
+		std::uint64_t m_Hash;
+		std::uint32_t m_Offset;
+	};
+#pragma pack(pop)
+
+	std::optional<std::uint32_t> PatternCache::GetCachedOffsetImpl(PatternHash hash)
 	{ 
 		if (auto it = m_Data.find(hash.GetHash()); it != m_Data.end())
 			return it->second;
@@ -11,42 +35,82 @@ namespace YimMenu
 		return std::nullopt;
 	}
 
-	void PatternCache::UpdateCachedOffsetImpl(PatternHash hash, int offset) 
+	void PatternCache::UpdateCachedOffsetImpl(PatternHash hash, std::uint32_t offset) 
 	{
-		m_Data[hash.GetHash()] = offset;
+		if (auto [it, inserted] = m_Data.try_emplace(hash.GetHash(), offset); inserted || it->second != offset)
+		{
+			it->second = offset;
+			m_Dirty    = true;
+		}
 	}
 
-	void PatternCache::InitImpl() 
+	bool PatternCache::InitImpl(const ModuleInfo& module, const std::filesystem::path& file) 
 	{ 
-		auto file = FileMgr::GetProjectFile("./pattern_cache.bin");
-		if (file.Exists())
-		{
-			std::ifstream stream(file.Path(), std::ios_base::binary);
-			while (!stream.eof())
-			{
-				std::uint64_t hash;
-				int offset;
+		m_File        = file;
+		m_Module      = module;
+		m_Initialized = true;
+		m_Dirty       = false;
+		m_Data.clear();
+
+		std::ifstream stream(file, std::ios_base::binary);
+		if (!stream)
+			return false;
 
-				stream.read(reinterpret_cast<char*>(&hash), sizeof(hash));
-				stream.read(reinterpret_cast<char*>(&offset), sizeof(offset));
+		const std::vector<std::uint8_t> buffer{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
 
-				m_Data.emplace(hash, offset);
-			}
+		PatternCacheHeader header;
+		if (buffer.size() < sizeof(header))
+			return false;
+		std::memcpy(&header, buffer.data(), sizeof(header));
+
+		if (header.m_Magic != Magic || header.m_Version != Version
+		    || ModuleInfo{header.m_ModuleSize, header.m_TimeDateStamp, header.m_CheckSum} != module
+		    || buffer.size() != sizeof(header) + header.m_RecordCount * sizeof(PatternCacheRecord))
+			return false;
+
+		const auto records = std::span(buffer).subspan(sizeof(header));
+		if (Crc32(records) != header.m_RecordCrc)
+			return false;
+
+		for (std::uint32_t i = 0; i < header.m_RecordCount; i++)
+		{
+			PatternCacheRecord record;
+			std::memcpy(&record, records.data() + i * sizeof(record), sizeof(record));
+			m_Data.emplace(record.m_Hash, record.m_Offset);
 		}
 
-		m_Initialized = true;
+		return true;
 	}
 
 	void PatternCache::UpdateImpl() 
 	{
-		auto file = FileMgr::GetProjectFile("./pattern_cache.bin");
-		std::ofstream stream(file.Path(), std::ios_base::binary);
+		if (!m_Initialized || !m_Dirty)
+			return;
 
-		for (auto& [h, offset] : m_Data)
+		std::vector<std::uint8_t> records(m_Data.size() * sizeof(PatternCacheRecord));
+		std::size_t i = 0;
+		for (const auto& [hash, offset] : m_Data)
 		{
-			auto hash = h;
-			stream.write(reinterpret_cast<char*>(&hash), sizeof(hash));
-			stream.write(reinterpret_cast<char*>(&offset), sizeof(offset));
+			const PatternCacheRecord record{hash, offset};
+			std::memcpy(records.data() + i++ * sizeof(record), &record, sizeof(record));
 		}
+
+		const PatternCacheHeader header{Magic, Version, m_Module.m_Size, m_Module.m_TimeDateStamp, m_Module.m_CheckSum, static_cast<std::uint32_t>(m_Data.size()), Crc32(records)};
+
+		// write next to the cache and swap it in, a crash halfway through must not leave a torn file behind
+		auto temp = m_File;
+		temp += ".tmp";
+		{
+			std::ofstream stream(temp, std::ios_base::binary | std::ios_base::trunc);
+			stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			stream.write(reinterpret_cast<const char*>(records.data()), records.size());
+			if (!stream.flush())
+				return;
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temp, m_File, ec);
+		if (!ec)
+			m_Dirty = false;
 	}
-}
\ No newline at end of file
+}
@@ -1,35 +1,73 @@
 #pragma once
 #include "core/memory/PatternHash.hpp"
 
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <unordered_map>
+
 namespace YimMenu
 {
+	/**
+	 * @brief Persists pattern offsets between launches in pattern_cache.bin
+	 * 
+	 * The file starts with a header identifying the module the offsets belong to, any mismatch (game update,
+	 * different executable, truncated or corrupted file) discards the whole cache.
+	 */
 	class PatternCache
 	{
+	public:
+		struct ModuleInfo
+		{
+			std::uint64_t m_Size;
+			std::uint32_t m_TimeDateStamp;
+			std::uint32_t m_CheckSum;
+
+			bool operator==(const ModuleInfo&) const = default;
+		};
+
+	private:
 		bool m_Initialized;
-		std::unordered_map<std::uint64_t, int> m_Data;
+		bool m_Dirty;
+		std::filesystem::path m_File;
+		ModuleInfo m_Module;
+		std::unordered_map<std::uint64_t, std::uint32_t> m_Data;
+
 	public:
+		static constexpr std::uint32_t Magic   = 0x32435054; // TPC2
+		static constexpr std::uint32_t Version = 2;
 
 		PatternCache() :
-		    m_Initialized(false)
+		    m_Initialized(false),
+		    m_Dirty(false),
+		    m_Module()
 		{
 		}
 
-		static void Init() 
-		{ 
-			GetInstance().InitImpl();
+		/**
+		 * @brief Loads the cache for a module
+		 * 
+		 * @return true If the file exists and was written for this exact module
+		 */
+		static bool Init(const ModuleInfo& module, const std::filesystem::path& file)
+		{
+			return GetInstance().InitImpl(module, file);
 		}
 
+		/**
+		 * @brief Writes the cache to disk if any offset changed since Init()
+		 */
 		static void Update()
 		{
 			GetInstance().UpdateImpl();
 		}
 
-		static std::optional<int> GetCachedOffset(PatternHash hash)
+		static std::optional<std::uint32_t> GetCachedOffset(PatternHash hash)
 		{
 			return GetInstance().GetCachedOffsetImpl(hash);
 		}
 
-		static void UpdateCachedOffset(PatternHash hash, int offset)
+		static void UpdateCachedOffset(PatternHash hash, std::uint32_t offset)
 		{
 			GetInstance().UpdateCachedOffsetImpl(hash, offset);
 		}
@@ -46,9 +84,9 @@ namespace YimMenu
 			return Instance;
 		}
 
-		void InitImpl();
+		bool InitImpl(const ModuleInfo& module, const std::filesystem::path& file);
 		void UpdateImpl();
-		std::optional<int> GetCachedOffsetImpl(PatternHash hash);
-		void UpdateCachedOffsetImpl(PatternHash hash, int offset);
+		std::optional<std::uint32_t> GetCachedOffsetImpl(PatternHash hash);
+		void UpdateCachedOffsetImpl(PatternHash hash, std::uint32_t offset);
 	};
-}
\ No newline at end of file
+}
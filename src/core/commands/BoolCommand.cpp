@@ -1,6 +1,7 @@
 #include "BoolCommand.hpp"
 #include "game/backend/FiberPool.hpp" // TODO: game import in core
 #include "Commands.hpp"
+#include "core/misc/TickProfiler.hpp"
 
 namespace YimMenu
 {
@@ -24,6 +25,7 @@ namespace YimMenu
 	void BoolCommand::LoadState(nlohmann::json& value)
 	{
 		m_State = value;
+		Commands::RefreshLoopedCommands();
 	}
 
 	bool BoolCommand::GetState()
@@ -35,24 +37,27 @@ namespace YimMenu
 	{
 		if (state && !m_State)
 			FiberPool::Push([this] {
-				OnEnable();
+				Initialize();
 			});
 		else if (!state && m_State)
 			FiberPool::Push([this] {
-				OnDisable();
+				Shutdown();
 			});
 
 		m_State = state;
+		Commands::RefreshLoopedCommands();
 		MarkDirty();
 	}
 
 	void BoolCommand::Initialize()
 	{
+		ProfileScope profile(TickProfiler::GetEntry(GetName(), "Enable"));
 		OnEnable();
 	}
 
 	void BoolCommand::Shutdown()
 	{
+		ProfileScope profile(TickProfiler::GetEntry(GetName(), "Disable"));
 		OnDisable();
 	}
 }
\ No newline at end of file
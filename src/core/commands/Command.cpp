@@ -1,6 +1,7 @@
 #include "util/Joaat.hpp"
 #include "Command.hpp"
 #include "Commands.hpp"
+#include "core/misc/FlightRecorder.hpp"
 
 namespace YimMenu
 {
@@ -16,11 +17,13 @@ namespace YimMenu
 
 	void Command::Call()
 	{
+		FlightRecorder::Record(FlightEvent::COMMAND, m_Hash);
 		OnCall();
 	}
 
 	void Command::MarkDirty()
 	{
+		m_Dirty = true;
 		Commands::MarkDirty();
 	}
 }
\ No newline at end of file
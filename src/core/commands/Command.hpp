@@ -1,6 +1,7 @@
 #pragma once
 #include "util/Joaat.hpp"
 
+#include <atomic>
 #include <nlohmann/json.hpp>
 
 
@@ -15,6 +16,7 @@ namespace YimMenu
 		joaat_t m_Hash;
 
 		int m_NumArgs = 0; // TODO: currently unused
+		std::atomic<bool> m_Dirty = false;
 
 	protected:
 		virtual void OnCall() = 0;
@@ -27,6 +29,14 @@ namespace YimMenu
 		virtual void SaveState(nlohmann::json& value){};
 		virtual void LoadState(nlohmann::json& value){};
 
+		/**
+		 * @brief Whether the state changed since it was last saved, clears the flag
+		 */
+		bool ConsumeDirty()
+		{
+			return m_Dirty.exchange(false);
+		}
+
 		const std::string& GetName()
 		{
 			return m_Name;
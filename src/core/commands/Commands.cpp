@@ -4,8 +4,13 @@
 
 namespace YimMenu
 {
+	// time per frame the commands that don't run every frame may take, the rest are run on the next one
+	static constexpr auto g_ScheduledCommandBudget = 1ms;
+
 	Commands::Commands() :
-	    IStateSerializer("commands")
+	    IStateSerializer("commands"),
+	    m_LoopedCommandsChanged(true),
+	    m_NextScheduledCommand(0)
 	{
 	}
 
@@ -22,6 +27,7 @@ namespace YimMenu
 	void Commands::AddLoopedCommandImpl(LoopedCommand* command)
 	{
 		m_LoopedCommands.push_back(command);
+		m_LoopedCommandsChanged = true;
 	}
 
 	void Commands::EnableBoolCommandsImpl()
@@ -31,11 +37,65 @@ namespace YimMenu
 				command->Initialize();
 	}
 
-	void Commands::RunLoopedCommandsImpl()
+	void Commands::UpdateActiveLoopedCommands()
 	{
+		const auto now = std::chrono::steady_clock::now();
+		auto previous  = std::move(m_ScheduledCommands);
+
+		m_EveryFrameCommands.clear();
+		m_ScheduledCommands.clear();
+		m_NextScheduledCommand = 0;
+
 		for (auto& command : m_LoopedCommands)
-			if (command->GetState())
-				command->Tick();
+		{
+			if (!command->GetState())
+				continue;
+
+			const auto interval = command->GetInterval();
+			if (interval.count() <= 0)
+			{
+				m_EveryFrameCommands.push_back(command);
+				continue;
+			}
+
+			// keep the schedule of commands that stayed enabled, offset new ones by their hash so commands with
+			// the same interval don't all come due on the same frame
+			auto it = std::ranges::find(previous, command, &ScheduledCommand::m_Command);
+			m_ScheduledCommands.push_back({command, it != previous.end() ? it->m_NextTick : now + std::chrono::milliseconds(command->GetHash() % interval.count())});
+		}
+	}
+
+	void Commands::RunLoopedCommandsImpl()
+	{
+		if (m_LoopedCommandsChanged.exchange(false))
+			UpdateActiveLoopedCommands();
+
+		for (auto& command : m_EveryFrameCommands)
+			command->Tick();
+
+		const auto now      = std::chrono::steady_clock::now();
+		const auto deadline = now + g_ScheduledCommandBudget;
+		const auto count    = m_ScheduledCommands.size();
+		bool ranAny         = false;
+
+		// round robin, a frame that runs out of budget continues with the first skipped command on the next one
+		for (std::size_t i = 0; i < count; i++)
+		{
+			const auto index = (m_NextScheduledCommand + i) % count;
+			auto& scheduled  = m_ScheduledCommands[index];
+			if (scheduled.m_NextTick > now)
+				continue;
+
+			if (ranAny && std::chrono::steady_clock::now() >= deadline)
+			{
+				m_NextScheduledCommand = index;
+				return;
+			}
+
+			scheduled.m_Command->Tick();
+			scheduled.m_NextTick = now + scheduled.m_Command->GetInterval();
+			ranAny               = true;
+		}
 	}
 
 	Command* Commands::GetCommandImpl(joaat_t hash)
@@ -49,6 +109,11 @@ namespace YimMenu
 	{
 		for (auto& command : m_Commands)
 		{
+			// everything else is still cached in the settings document from the last save or the initial load
+			const bool dirty = command.second->ConsumeDirty();
+			if (!dirty && state.contains(command.second->GetName()))
+				continue;
+
 			if (!state.contains(command.second->GetName()))
 				state[command.second->GetName()] = nlohmann::json::object();
 
@@ -12,9 +12,21 @@ namespace YimMenu
 		private IStateSerializer
 	{
 	private:
+		struct ScheduledCommand
+		{
+			LoopedCommand* m_Command;
+			std::chrono::steady_clock::time_point m_NextTick;
+		};
+
 		std::unordered_map<joaat_t, Command*> m_Commands;
 		std::vector<LoopedCommand*> m_LoopedCommands;
 		std::vector<BoolCommand*> m_BoolCommands;
+
+		// enabled looped commands only, rebuilt on the script thread whenever a bool command changes state
+		std::atomic<bool> m_LoopedCommandsChanged;
+		std::vector<LoopedCommand*> m_EveryFrameCommands;
+		std::vector<ScheduledCommand> m_ScheduledCommands;
+		std::size_t m_NextScheduledCommand;
 		Commands();
 
 	public:
@@ -63,6 +75,14 @@ namespace YimMenu
 		{
 			GetInstance().MarkStateDirty();
 		}
+
+		/**
+		 * @brief Picks up enabled and disabled looped commands before the next RunLoopedCommands(), safe to call from any thread
+		 */
+		static void RefreshLoopedCommands()
+		{
+			GetInstance().m_LoopedCommandsChanged = true;
+		}
 		
 		static void Shutdown()
 		{
@@ -75,6 +95,7 @@ namespace YimMenu
 		void AddLoopedCommandImpl(LoopedCommand* command);
 		void EnableBoolCommandsImpl();
 		void RunLoopedCommandsImpl();
+		void UpdateActiveLoopedCommands();
 		Command* GetCommandImpl(joaat_t hash);
 		virtual void SaveStateImpl(nlohmann::json& state) override;
 		virtual void LoadStateImpl(nlohmann::json& state) override;
@@ -0,0 +1,85 @@
+#include "HotkeyMatcher.hpp"
+
+#include <algorithm>
+
+namespace YimMenu
+{
+	void HotkeyMatcher::Clear()
+	{
+		for (auto key : m_WatchedKeys)
+			m_KeyToChords[key].clear();
+
+		m_Chords.clear();
+		m_WatchedKeys.clear();
+		m_Held.clear();
+	}
+
+	void HotkeyMatcher::Add(std::uint32_t id, std::span<const int> keys)
+	{
+		const auto index = static_cast<std::uint32_t>(m_Chords.size());
+		Chord chord{id, 0, 0};
+
+		for (auto key : keys)
+		{
+			if (key < 0 || key >= static_cast<int>(m_KeyToChords.size()))
+				continue;
+
+			auto& chords = m_KeyToChords[key];
+			if (!chords.empty() && chords.back() == index)
+				continue; // same key twice in this chord
+
+			if (chords.empty())
+				m_WatchedKeys.push_back(static_cast<std::uint8_t>(key));
+
+			chords.push_back(index);
+			chord.m_Size++;
+			chord.m_Pressed += m_Previous.test(key);
+		}
+
+		if (!chord.m_Size)
+			return;
+
+		m_Chords.push_back(chord);
+		UpdateHeld();
+	}
+
+	const std::vector<std::uint32_t>& HotkeyMatcher::Update(const KeyState& keys)
+	{
+		const auto changed = keys ^ m_Previous;
+		m_Previous         = keys;
+
+		if (changed.none())
+			return m_Held;
+
+		bool heldChanged = false;
+		for (auto key : m_WatchedKeys)
+		{
+			if (!changed.test(key))
+				continue;
+
+			const bool pressed = keys.test(key);
+			for (auto index : m_KeyToChords[key])
+			{
+				auto& chord    = m_Chords[index];
+				const bool was = chord.m_Pressed == chord.m_Size;
+				chord.m_Pressed += pressed ? 1 : -1;
+				heldChanged |= was != (chord.m_Pressed == chord.m_Size);
+			}
+		}
+
+		if (heldChanged)
+			UpdateHeld();
+
+		return m_Held;
+	}
+
+	void HotkeyMatcher::UpdateHeld()
+	{
+		m_Held.clear();
+		for (const auto& chord : m_Chords)
+		{
+			if (chord.m_Pressed == chord.m_Size)
+				m_Held.push_back(chord.m_Id);
+		}
+	}
+}
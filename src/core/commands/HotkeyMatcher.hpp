@@ -0,0 +1,59 @@
+#pragma once
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Tracks which key chords are held down, platform independent so it can be fed synthetic key states
+	 *
+	 * Every chord keeps a count of its pressed keys and an index maps each key to the chords that contain it,
+	 * so a tick only touches the chords of keys whose state actually changed.
+	 */
+	class HotkeyMatcher
+	{
+	public:
+		using KeyState = std::bitset<256>;
+
+		void Clear();
+
+		/**
+		 * @brief Registers a chord, keys outside of 0-255 and duplicates are ignored
+		 */
+		void Add(std::uint32_t id, std::span<const int> keys);
+
+		/**
+		 * @brief Every key that is part of a chord, the only ones worth capturing for Update()
+		 */
+		std::span<const std::uint8_t> GetWatchedKeys() const
+		{
+			return m_WatchedKeys;
+		}
+
+		/**
+		 * @brief Feeds the key state of one tick
+		 *
+		 * @return const std::vector<std::uint32_t>& Ids of the chords that are fully held, in registration order
+		 */
+		const std::vector<std::uint32_t>& Update(const KeyState& keys);
+
+	private:
+		struct Chord
+		{
+			std::uint32_t m_Id;
+			std::uint32_t m_Size;
+			std::uint32_t m_Pressed;
+		};
+
+		void UpdateHeld();
+
+		std::vector<Chord> m_Chords;
+		std::array<std::vector<std::uint32_t>, 256> m_KeyToChords;
+		std::vector<std::uint8_t> m_WatchedKeys;
+		std::vector<std::uint32_t> m_Held;
+		KeyState m_Previous;
+	};
+}
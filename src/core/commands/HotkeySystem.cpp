@@ -25,18 +25,15 @@ namespace YimMenu
 
 	bool HotkeySystem::ListenAndApply(int& Hotkey, std::vector<int> Blacklist)
 	{
-		static auto IsKeyBlacklisted = [Blacklist](int Key) -> bool {
-			for (auto Key_ : Blacklist)
-				if (Key_ == Key)
-					return true;
-
+		// one snapshot of the keyboard instead of polling GetKeyState for every key, same thread local state
+		BYTE keys[256];
+		if (!GetKeyboardState(keys))
 			return false;
-		};
 
 		// VK_OEM_CLEAR Is about the limit in terms of virtual key codes
 		for (int i = 0; i < VK_OEM_CLEAR; i++)
 		{
-			if ((GetKeyState(i) & 0x8000) && i != 1 && !IsKeyBlacklisted(i))
+			if ((keys[i] & 0x80) && i != 1 && std::ranges::find(Blacklist, i) == Blacklist.end())
 			{
 				Hotkey = i;
 
@@ -48,60 +45,73 @@ namespace YimMenu
 	}
 
 	// Will return the keycode if there are no labels
-	std::string HotkeySystem::GetHotkeyLabel(int HotkeyModifier)
+	const std::string& HotkeySystem::GetHotkeyLabel(int HotkeyModifier)
 	{
-		char KeyName[32];
-		GetKeyNameTextA(MapVirtualKey(HotkeyModifier, MAPVK_VK_TO_VSC) << 16, KeyName, 32);
+		static const std::string invalid = "?";
+		if (HotkeyModifier < 0 || HotkeyModifier >= m_Labels.size())
+			return invalid;
 
-		if (std::string(KeyName).empty())
-			strcpy(KeyName, std::to_string(HotkeyModifier).data());
+		auto& label = m_Labels[HotkeyModifier];
+		if (label.empty())
+		{
+			char KeyName[32]{};
+			GetKeyNameTextA(MapVirtualKey(HotkeyModifier, MAPVK_VK_TO_VSC) << 16, KeyName, 32);
+
+			label = KeyName[0] ? KeyName : std::to_string(HotkeyModifier);
+		}
 
-		return KeyName;
+		return label;
 	}
 
 	// Meant to be called in a loop
 	void HotkeySystem::CreateHotkey(std::vector<int>& chain)
 	{
-		static auto is_key_unique = [this](int Key, std::vector<int> List) -> bool {
+		const auto is_key_unique = [this](int Key, const std::vector<int>& List) -> bool {
+			const auto& label = GetHotkeyLabel(Key);
 			for (auto& Key_ : List)
-				if (GetHotkeyLabel(Key_) == GetHotkeyLabel(Key))
+				if (GetHotkeyLabel(Key_) == label)
 					return false;
 
 			return true;
 		};
 
 		int pressed_key = 0;
-		ListenAndApply(pressed_key, chain);
+		if (!ListenAndApply(pressed_key, chain))
+			return;
 
 		if (pressed_key > 1)
 		{
 			if (is_key_unique(pressed_key, chain))
 			{
 				chain.push_back(pressed_key);
+
+				// only on a change, this runs every frame while a setter is open
+				MarkHotkeysDirty();
 			}
 		}
-
-		MarkStateDirty();
 	}
 
 	void HotkeySystem::Update()
 	{
-		for (auto& [hash, link] : m_CommandHotkeys)
+		if (m_MatcherDirty.exchange(false))
 		{
-			if (link.m_Chain.empty() || link.m_BeingModified)
-				continue;
+			m_Matcher.Clear();
+			for (auto& [hash, link] : m_CommandHotkeys)
+				m_Matcher.Add(hash, link.m_Chain);
+		}
 
-			bool all_keys_pressed = true;
+		// only the keys that are part of a hotkey, each polled once per tick no matter how many chains use it
+		HotkeyMatcher::KeyState keys;
+		for (auto key : m_Matcher.GetWatchedKeys())
+			if (GetAsyncKeyState(key) & 0x8000)
+				keys.set(key);
 
-			for (auto modifier : link.m_Chain)
-			{
-				if (!(GetAsyncKeyState(modifier) & 0x8000))
-				{
-					all_keys_pressed = false;
-				}
-			}
+		for (auto hash : m_Matcher.Update(keys))
+		{
+			if (auto it = m_CommandHotkeys.find(hash); it == m_CommandHotkeys.end() || it->second.m_BeingModified)
+				continue;
 
-			if (all_keys_pressed && std::chrono::system_clock::now() - m_LastHotkeyTriggerTime > 100ms)
+			if (std::chrono::system_clock::now() - m_LastHotkeyTriggerTime > 100ms)
 			{
 				auto command = Commands::GetCommand(hash);
 				if (command)
@@ -149,10 +159,13 @@ namespace YimMenu
 				// skip invalid keys gracefully
 			}
 		}
+
+		m_MatcherDirty = true;
 	}
 
 	void HotkeySystem::MarkHotkeysDirty()
 	{
+		m_MatcherDirty = true;
 		MarkStateDirty();
 	}
 }
@@ -1,5 +1,8 @@
 #pragma once
 #include "core/settings/IStateSerializer.hpp"
+#include "HotkeyMatcher.hpp"
+#include <array>
+#include <atomic>
 #include <map>
 #include <string>
 #include <vector>
@@ -23,6 +26,9 @@ namespace YimMenu
 		private IStateSerializer
 	{
 		std::chrono::system_clock::time_point m_LastHotkeyTriggerTime;
+		HotkeyMatcher m_Matcher;
+		std::atomic<bool> m_MatcherDirty = true; // chains changed, rebuilt by the next Update()
+		std::array<std::string, 256> m_Labels;    // GetKeyNameTextA is slow, filled on first use
 
 	public:
 		HotkeySystem();
@@ -30,7 +36,7 @@ namespace YimMenu
 		std::map<uint32_t, CommandLink> m_CommandHotkeys;
 		void RegisterCommands();
 		bool ListenAndApply(int& Hotkey, std::vector<int> blacklist = {0});
-		std::string GetHotkeyLabel(int hotkey_modifiers);
+		const std::string& GetHotkeyLabel(int hotkey_modifiers);
 		void CreateHotkey(std::vector<int>& Hotkey);
 
 		void Update();
@@ -3,14 +3,17 @@
 
 namespace YimMenu
 {
-	LoopedCommand::LoopedCommand(std::string name, std::string label, std::string description) : 
-		BoolCommand(name, label, description)
+	LoopedCommand::LoopedCommand(std::string name, std::string label, std::string description, std::chrono::milliseconds interval) : 
+		BoolCommand(name, label, description),
+		m_Interval(interval),
+		m_Profile(TickProfiler::GetEntry(name, "Tick"))
 	{
 		Commands::AddLoopedCommand(this);
 	}
 
 	void LoopedCommand::Tick()
 	{
+		ProfileScope profile(m_Profile);
 		OnTick();
 	}
 }
\ No newline at end of file
@@ -1,15 +1,28 @@
 #pragma once
 #include "BoolCommand.hpp"
+#include "core/misc/TickProfiler.hpp"
 
 namespace YimMenu
 {
 	class LoopedCommand : public BoolCommand
 	{
+		std::chrono::milliseconds m_Interval;
+		TickProfiler::Entry* m_Profile;
+
 	protected:
 		virtual void OnTick() = 0;
 
 	public:
-		LoopedCommand(std::string name, std::string label, std::string description);
+		/**
+		 * @param interval How often OnTick() runs while enabled, zero for every frame. Commands with an interval are
+		 * spread across frames and may run a frame late when the frame's budget is already spent.
+		 */
+		LoopedCommand(std::string name, std::string label, std::string description, std::chrono::milliseconds interval = {});
 		void Tick();
+
+		std::chrono::milliseconds GetInterval()
+		{
+			return m_Interval;
+		}
 	};
 }
\ No newline at end of file
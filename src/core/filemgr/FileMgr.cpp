@@ -1,6 +1,8 @@
 #include "FileMgr.hpp"
+
 #include "File.hpp"
 #include "Folder.hpp"
+#include "core/misc/Tracer.hpp"
 
 namespace YimMenu
 {
@@ -11,6 +13,7 @@ namespace YimMenu
 
     void FileMgr::InitImpl(const std::filesystem::path& rootFolder)
     {
+        TRACE_SCOPE("FileMgr::Init");
         m_RootFolder = rootFolder;
 
         CreateFolderIfNotExists(m_RootFolder);
@@ -6,6 +6,7 @@
 #include "VMTHook.hpp"
 #include "VtableHook.hpp"
 #include "core/memory/ModuleMgr.hpp"
+#include "core/misc/Tracer.hpp"
 #include "game/hooks/Hooks.hpp"
 #include "game/pointers/Pointers.hpp"
 
@@ -41,6 +42,8 @@ namespace YimMenu
 
 	bool Hooking::InitImpl() 
 	{ 
+		TRACE_SCOPE("Hooking::Init");
+
 		BaseHook::Add<Hooks::Window::ShowWindow>(new DetourHook("ShowWindow", ModuleMgr.Get("user32.dll")->GetExport<void*>("ShowWindow"), Hooks::Window::ShowWindow));
 
 		BaseHook::Add<Hooks::Anticheat::SendMetric>(new DetourHook("SendMetric", Pointers.SendMetric, Hooks::Anticheat::SendMetric));
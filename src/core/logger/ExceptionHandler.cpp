@@ -1,6 +1,7 @@
 #include "ExceptionHandler.hpp"
 
 #include "StackTrace.hpp"
+#include "core/misc/FlightRecorder.hpp"
 
 #include <hde64.h>
 #include <unordered_set>
@@ -40,9 +41,12 @@ namespace YimMenu
 
 		trace.NewStackTrace(exception_info);
 		const auto trace_hash = HashStackTrace(trace.GetFramePointers());
+		FlightRecorder::Record(FlightEvent::EXCEPTION, exception_code, reinterpret_cast<std::uint64_t>(exception_info->ExceptionRecord->ExceptionAddress), trace_hash);
 		if (const auto it = logged_exceptions.find(trace_hash); it == logged_exceptions.end())
 		{
 			LOG(FATAL) << trace;
+			if (FlightRecorder::Dump())
+				LOG(FATAL) << "Recent events written to crash_events.bin, decode them with TerminusFlightDecode";
 			Logger::FlushQueue();
 
 			logged_exceptions.insert(trace_hash);
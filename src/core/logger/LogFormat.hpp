@@ -0,0 +1,159 @@
+#pragma once
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// the log line layout without any dependency on AsyncLogger, so it can be measured outside the game
+namespace YimMenu::LogFormat
+{
+	// amount of fractional second digits std::format prints for %S of a duration with this period
+	template<typename Period>
+	inline constexpr int SubsecondDigits()
+	{
+		std::intmax_t scale = 1;
+		for (int digits = 0; digits <= 18; digits++, scale *= 10)
+		{
+			if ((scale * Period::num) % Period::den == 0)
+				return digits;
+		}
+		return 6;
+	}
+
+	inline void AppendDigits(std::string& out, std::uint64_t value, int digits)
+	{
+		char buffer[20];
+		for (int i = digits - 1; i >= 0; i--, value /= 10)
+			buffer[i] = static_cast<char>('0' + value % 10);
+		out.append(buffer, digits);
+	}
+
+	/**
+	 * @brief Formats log lines into a buffer that is reused for every line, one instance per thread
+	 *
+	 * Besides the buffer it caches the "HH:MM:SS" of the current second and the file name of every call site,
+	 * so after the first few lines formatting no longer allocates.
+	 * The output is identical to what the sink used to build with std::stringstream and std::format.
+	 */
+	class LineFormatter
+	{
+	public:
+		/**
+		 * @brief A line of cout.log: "[12:34:56.1234567][INFO/main.cpp:42] message"
+		 *
+		 * @param file The full source path of the call site, must outlive the formatter (std::source_location::file_name())
+		 * @return std::string_view Valid until the next call
+		 */
+		template<typename Clock, typename Duration>
+		std::string_view FormatFile(std::string_view level, std::chrono::time_point<Clock, Duration> timestamp, const char* file, std::uint32_t line, std::string_view message)
+		{
+			m_Buffer.clear();
+			m_Buffer += '[';
+			AppendTimestamp(timestamp);
+			m_Buffer += "][";
+			AppendLocation(level, file, line);
+			m_Buffer += "] ";
+			m_Buffer += message;
+			return m_Buffer;
+		}
+
+		/**
+		 * @brief Same as FormatFile() with the level and location colored by an ANSI color code
+		 */
+		template<typename Clock, typename Duration>
+		std::string_view FormatConsole(std::string_view level, int color, std::chrono::time_point<Clock, Duration> timestamp, const char* file, std::uint32_t line, std::string_view message)
+		{
+			m_Buffer.clear();
+			m_Buffer += '[';
+			AppendTimestamp(timestamp);
+			m_Buffer += "]\x1b[";
+			AppendNumber(color);
+			m_Buffer += "m[";
+			AppendLocation(level, file, line);
+			m_Buffer += "] \x1b[0m";
+			m_Buffer += message;
+			return m_Buffer;
+		}
+
+	private:
+		// time of day in UTC, identical to std::format("{0:%H:%M:%S}", timestamp)
+		template<typename Clock, typename Duration>
+		void AppendTimestamp(std::chrono::time_point<Clock, Duration> timestamp)
+		{
+			using namespace std::chrono;
+			using Period          = typename Duration::period;
+			constexpr auto digits = SubsecondDigits<Period>();
+
+			const auto sinceEpoch = timestamp.time_since_epoch();
+			const auto second     = floor<seconds>(sinceEpoch);
+			if (second.count() != m_Second)
+			{
+				auto rest         = second - floor<days>(second);
+				const auto hour   = duration_cast<hours>(rest);
+				const auto minute = duration_cast<minutes>(rest - hour);
+				const auto secs   = rest - hour - minute;
+
+				m_SecondText.clear();
+				AppendDigits(m_SecondText, hour.count(), 2);
+				m_SecondText += ':';
+				AppendDigits(m_SecondText, minute.count(), 2);
+				m_SecondText += ':';
+				AppendDigits(m_SecondText, secs.count(), 2);
+				m_Second = second.count();
+			}
+			m_Buffer += m_SecondText;
+
+			if constexpr (digits > 0)
+			{
+				constexpr auto scale = [] {
+					std::uint64_t scale = 1;
+					for (int i = 0; i < digits; i++)
+						scale *= 10;
+					return scale;
+				}();
+
+				const auto fraction = sinceEpoch - duration_cast<Duration>(second);
+				m_Buffer += '.';
+				AppendDigits(m_Buffer, static_cast<std::uint64_t>(fraction.count()) * Period::num * scale / Period::den, digits);
+			}
+		}
+
+		void AppendLocation(std::string_view level, const char* file, std::uint32_t line)
+		{
+			m_Buffer += level;
+			m_Buffer += '/';
+			m_Buffer += GetFileName(file);
+			m_Buffer += ':';
+			AppendNumber(line);
+		}
+
+		void AppendNumber(std::uint32_t value)
+		{
+			char buffer[10];
+			const auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+			m_Buffer.append(buffer, end);
+		}
+
+		// file_name() of a call site always points at the same string, remember where its file name starts
+		std::string_view GetFileName(const char* file)
+		{
+			auto [it, inserted] = m_FileNames.try_emplace(file);
+			if (inserted)
+			{
+				std::string_view path = file;
+				if (const auto separator = path.find_last_of("/\\"); separator != std::string_view::npos)
+					path.remove_prefix(separator + 1);
+				it->second = path;
+			}
+			return it->second;
+		}
+
+		std::string m_Buffer;
+		std::string m_SecondText;
+		std::int64_t m_Second = std::numeric_limits<std::int64_t>::min();
+		std::unordered_map<const char*, std::string_view> m_FileNames;
+	};
+}
@@ -1,10 +1,22 @@
 #include "LogHelper.hpp"
+#include "LogLimiter.hpp"
 #include "LogSink.hpp"
 
 #include "core/filemgr/FileMgr.hpp"
 
 namespace YimMenu
 {
+	static void LogSuppressed(std::size_t level, const char* file, std::uint32_t line, std::uint32_t suppressed)
+	{
+		const auto site = std::filesystem::path(file).filename().string() + ":" + std::to_string(line);
+		switch (static_cast<eLogLevel>(level))
+		{
+		case eLogLevel::VERBOSE: LOG(VERBOSE) << "Suppressed " << suppressed << " similar messages from " << site; break;
+		case eLogLevel::INFO: LOG(INFO) << "Suppressed " << suppressed << " similar messages from " << site; break;
+		default: LOG(WARNING) << "Suppressed " << suppressed << " similar messages from " << site; break;
+		}
+	}
+
 	template<typename TP>
 	static std::time_t to_time_t(TP tp)
 	{
@@ -30,6 +42,7 @@ namespace YimMenu
 
 	void LogHelper::DestroyImpl()
 	{
+		LogLimiter::SetSummaryHandler(nullptr);
 		Logger::Destroy();
 		CloseOutputStreams();
 
@@ -82,6 +95,7 @@ namespace YimMenu
 
 			m_FileOut.flush();
 		});
+		LogLimiter::SetSummaryHandler(&LogSuppressed);
 
 		return true;
 	}
@@ -0,0 +1,152 @@
+#include "LogLimiter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace YimMenu
+{
+	static constexpr std::int64_t g_FlushInterval = 1'000'000'000; // ns
+
+	// defaults for a flood of identical lines, fatal errors are never dropped
+	static constexpr std::array<LogLimiter::Limit, LogLimiter::g_LevelCount> g_DefaultLimits{{
+	    {20, 10}, // VERBOSE
+	    {20, 10}, // INFO
+	    {10, 2},  // WARNING
+	    {0, 0},   // FATAL
+	}};
+
+	static std::int64_t Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static std::uint64_t Pack(LogLimiter::Limit limit)
+	{
+		return static_cast<std::uint64_t>(limit.m_Burst) << 32 | limit.m_PerSecond;
+	}
+
+	static LogLimiter::Limit Unpack(std::uint64_t limit)
+	{
+		return {static_cast<std::uint32_t>(limit >> 32), static_cast<std::uint32_t>(limit)};
+	}
+
+	LogLimiter::LogLimiter() :
+	    m_Enabled(false),
+	    m_Handler(nullptr),
+	    m_Sites(nullptr),
+	    m_Pending(0),
+	    m_NextFlush(0)
+	{
+		for (std::size_t level = 0; level < g_LevelCount; level++)
+			m_Limits[level] = Pack(g_DefaultLimits[level]);
+		UpdateActive();
+	}
+
+	void LogLimiter::SetEnabled(bool enabled)
+	{
+		auto& instance = GetInstance();
+		instance.m_Enabled = enabled;
+		instance.UpdateActive();
+	}
+
+	void LogLimiter::SetLimit(std::size_t level, Limit limit)
+	{
+		if (level >= g_LevelCount)
+			return;
+
+		auto& instance          = GetInstance();
+		instance.m_Limits[level] = Pack(limit);
+		instance.UpdateActive();
+	}
+
+	void LogLimiter::SetSummaryHandler(SummaryHandler handler)
+	{
+		GetInstance().m_Handler = handler;
+	}
+
+	void LogLimiter::Flush()
+	{
+		auto& instance = GetInstance();
+		if (!instance.m_Pending.load(std::memory_order_relaxed))
+			return;
+
+		instance.FlushImpl();
+	}
+
+	void LogLimiter::UpdateActive()
+	{
+		for (std::size_t level = 0; level < g_LevelCount; level++)
+			m_Active[level] = m_Enabled && Unpack(m_Limits[level]).m_PerSecond;
+	}
+
+	bool LogLimiter::AllowImpl(Site& site, std::size_t level)
+	{
+		const auto limit = Unpack(m_Limits[level].load(std::memory_order_relaxed));
+		const auto now   = Now();
+
+		std::unique_lock lock(site.m_Mutex);
+		if (!site.m_LastRefill)
+		{
+			site.m_Tokens     = limit.m_Burst;
+			site.m_LastRefill = now;
+			site.m_Level      = level;
+
+			// sites are never destroyed, they are function local statics
+			site.m_Next = m_Sites.load(std::memory_order_relaxed);
+			while (!m_Sites.compare_exchange_weak(site.m_Next, &site, std::memory_order_release, std::memory_order_relaxed))
+				;
+		}
+		else
+		{
+			site.m_Tokens     = std::min<double>(limit.m_Burst, site.m_Tokens + (now - site.m_LastRefill) * 1e-9 * limit.m_PerSecond);
+			site.m_LastRefill = now;
+		}
+
+		if (site.m_Tokens < 1.0)
+		{
+			if (site.m_Suppressed++ == 0)
+				m_Pending++;
+			return false;
+		}
+
+		site.m_Tokens -= 1.0;
+		const auto suppressed = std::exchange(site.m_Suppressed, 0);
+		lock.unlock();
+
+		// the summary goes right before the first line that gets through again
+		if (suppressed)
+		{
+			m_Pending--;
+			Report(level, site.m_File, site.m_Line, suppressed);
+		}
+		return true;
+	}
+
+	void LogLimiter::FlushImpl()
+	{
+		const auto now = Now();
+		auto next      = m_NextFlush.load(std::memory_order_relaxed);
+		if (now < next || !m_NextFlush.compare_exchange_strong(next, now + g_FlushInterval, std::memory_order_relaxed))
+			return;
+
+		for (auto site = m_Sites.load(std::memory_order_acquire); site; site = site->m_Next)
+		{
+			std::unique_lock lock(site->m_Mutex);
+			const auto suppressed = std::exchange(site->m_Suppressed, 0);
+			lock.unlock();
+
+			if (suppressed)
+			{
+				m_Pending--;
+				Report(site->m_Level, site->m_File, site->m_Line, suppressed);
+			}
+		}
+	}
+
+	void LogLimiter::Report(std::size_t level, const char* file, std::uint32_t line, std::uint32_t suppressed)
+	{
+		if (const auto handler = m_Handler.load(std::memory_order_relaxed))
+			handler(level, file, line, suppressed);
+	}
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Per call site token bucket for log lines that can be flooded from the network
+	 *
+	 * Every LOG_LIMITED() expansion owns a bucket, once it runs dry the lines of that call site are dropped and
+	 * counted until tokens refill, then a single "suppressed N similar messages" summary is logged in their place.
+	 * Limits are configured per level. A level without a limit, or the limiter being disabled, costs a single load.
+	 */
+	class LogLimiter
+	{
+	public:
+		static constexpr std::size_t g_LevelCount = 4; // VERBOSE, INFO, WARNING, FATAL
+
+		struct Limit
+		{
+			std::uint32_t m_Burst;     // lines allowed back to back
+			std::uint32_t m_PerSecond; // lines the bucket refills per second, 0 leaves the level unlimited
+		};
+
+		class Site
+		{
+		public:
+			constexpr Site(const char* file, std::uint32_t line) :
+			    m_File(file),
+			    m_Line(line)
+			{
+			}
+
+			Site(const Site&)            = delete;
+			Site& operator=(const Site&) = delete;
+
+		private:
+			friend class LogLimiter;
+
+			const char* m_File;
+			std::uint32_t m_Line;
+			std::mutex m_Mutex;
+			double m_Tokens           = 0.0;
+			std::int64_t m_LastRefill = 0; // 0 until the first line, the bucket starts out full
+			std::size_t m_Level       = 0;
+			std::uint32_t m_Suppressed = 0;
+			Site* m_Next              = nullptr; // intrusive list of every site that has been used
+		};
+
+		// called outside of any lock, usually just logs the summary
+		using SummaryHandler = void (*)(std::size_t level, const char* file, std::uint32_t line, std::uint32_t suppressed);
+
+		/**
+		 * @brief Whether a line of this call site may be logged, consumes a token if so
+		 */
+		static bool Allow(Site& site, std::size_t level)
+		{
+			auto& instance = GetInstance();
+			if (level >= g_LevelCount || !instance.m_Active[level].load(std::memory_order_relaxed))
+				return true;
+
+			return instance.AllowImpl(site, level);
+		}
+
+		/**
+		 * @brief Starts out disabled, the limitlogfloods command turns it on once the commands are loaded
+		 */
+		static void SetEnabled(bool enabled);
+		static void SetLimit(std::size_t level, Limit limit);
+		static void SetSummaryHandler(SummaryHandler handler);
+
+		/**
+		 * @brief Reports the lines suppressed at call sites that went quiet, call this periodically
+		 *
+		 * Returns immediately if nothing was suppressed or the last flush was less than a second ago.
+		 */
+		static void Flush();
+
+	private:
+		LogLimiter();
+
+		static LogLimiter& GetInstance()
+		{
+			static LogLimiter i{};
+			return i;
+		}
+
+		bool AllowImpl(Site& site, std::size_t level);
+		void FlushImpl();
+		void UpdateActive();
+		void Report(std::size_t level, const char* file, std::uint32_t line, std::uint32_t suppressed);
+
+		std::array<std::atomic<bool>, g_LevelCount> m_Active;
+		std::array<std::atomic<std::uint64_t>, g_LevelCount> m_Limits; // Limit packed as burst << 32 | per second
+		std::atomic<bool> m_Enabled;
+		std::atomic<SummaryHandler> m_Handler;
+		std::atomic<Site*> m_Sites;
+		std::atomic<std::uint32_t> m_Pending;  // sites with suppressed lines that were not reported yet
+		std::atomic<std::int64_t> m_NextFlush;
+	};
+}
+
+// the lambda gives every expansion its own constant initialized site without a guard variable
+#define LOG_LIMITER_SITE()                                       \
+	[]() -> ::YimMenu::LogLimiter::Site& {                       \
+		static ::YimMenu::LogLimiter::Site site{__FILE__, __LINE__}; \
+		return site;                                             \
+	}()
+
+/**
+ * @brief Consumes a token of this call site, use it to gate a block of lines or work that only feeds a log line
+ */
+#define LOG_LIMITED_ALLOWED(level) ::YimMenu::LogLimiter::Allow(LOG_LIMITER_SITE(), static_cast<std::size_t>(level))
+
+/**
+ * @brief LOG() that is rate limited per call site, the stream is not evaluated for dropped lines
+ */
+#define LOG_LIMITED(level)               \
+	if (!LOG_LIMITED_ALLOWED(level)) \
+	{                                    \
+	}                                    \
+	else                                 \
+		LOG(level)
@@ -1,6 +1,7 @@
 #include "LogSink.hpp"
 
 #include "LogColor.hpp"
+#include "LogFormat.hpp"
 
 namespace YimMenu
 {
@@ -23,35 +24,21 @@ namespace YimMenu
 		return levelStrings[level];
 	}
 
-	std::string LogSink::FormatConsole(const LogMessagePtr msg)
-	{
-		std::stringstream out;
+	// sinks run on the logger thread, the formatter's buffer and caches are reused for every line
+	static thread_local LogFormat::LineFormatter t_ConsoleFormatter;
+	static thread_local LogFormat::LineFormatter t_FileFormatter;
 
-		const auto timestamp = std::format("{0:%H:%M:%S}", msg->Timestamp());
+	std::string_view LogSink::FormatConsole(const LogMessagePtr msg)
+	{
 		const auto& location = msg->Location();
 		const auto level     = msg->Level();
-		const auto color     = LogSink::GetColor(level);
-
-		const auto file = std::filesystem::path(location.file_name()).filename().string();
-
-		out << "[" << timestamp << "]" << ADD_COLOR_TO_STREAM(color) << "[" << GetLevelStr(level) << "/" << file << ":"
-		    << location.line() << "] " << RESET_STREAM_COLOR << msg->Message();
 
-		return out.str();
+		return t_ConsoleFormatter.FormatConsole(GetLevelStr(level), static_cast<int>(GetColor(level)), msg->Timestamp(), location.file_name(), location.line(), msg->Message());
 	}
 
-	std::string LogSink::FormatFile(const LogMessagePtr msg)
+	std::string_view LogSink::FormatFile(const LogMessagePtr msg)
 	{
-		std::stringstream out;
-
-		const auto timestamp = std::format("{0:%H:%M:%S}", msg->Timestamp());
 		const auto& location = msg->Location();
-		const auto level     = msg->Level();
-		const auto file      = std::filesystem::path(location.file_name()).filename().string();
-
-		out << "[" << timestamp << "]"
-		    << "[" << GetLevelStr(level) << "/" << file << ":" << location.line() << "] " << msg->Message();
-
-		return out.str();
+		return t_FileFormatter.FormatFile(GetLevelStr(msg->Level()), msg->Timestamp(), location.file_name(), location.line(), msg->Message());
 	}
 }
@@ -2,6 +2,7 @@
 #include <AsyncLogger/Logger.hpp>
 #include <memory>
 #include <string>
+#include <string_view>
 
 
 namespace YimMenu
@@ -16,7 +17,8 @@ namespace YimMenu
 		static const char* GetLevelStr(const eLogLevel level);
 
 	public:
-		static std::string FormatConsole(const LogMessagePtr msg);
-		static std::string FormatFile(const LogMessagePtr msg);
+		// both return a view of a per-thread buffer, valid until the next line is formatted on the same thread
+		static std::string_view FormatConsole(const LogMessagePtr msg);
+		static std::string_view FormatFile(const LogMessagePtr msg);
 	};
 }
\ No newline at end of file
@@ -47,6 +47,15 @@ namespace YimMenu
 		return nullptr;
 	}
 
+	std::optional<PeImage> Module::GetImage() const
+	{
+		const auto ntHeader = GetNtHeader();
+		if (!ntHeader)
+			return std::nullopt;
+
+		return PeImage::Parse({m_Base.As<const std::uint8_t*>(), ntHeader->OptionalHeader.SizeOfImage}, PeLayout::MAPPED);
+	}
+
 	bool Module::Valid() const
 	{
 		return m_Size;
@@ -1,4 +1,5 @@
 #pragma once
+#include "PeImage.hpp"
 #include "PointerCalculator.hpp"
 #include "common.hpp"
 
@@ -35,6 +36,12 @@ namespace YimMenu
 		 * @return void** 
 		 */
 		void** GetImport(const std::string_view moduleName, const std::string_view symbolName) const;
+		/**
+		 * @brief Parses the section table of the mapped module
+		 * 
+		 * @return std::optional<PeImage> Nothing if the module has no valid PE headers
+		 */
+		std::optional<PeImage> GetImage() const;
 
 		bool Valid() const;
 
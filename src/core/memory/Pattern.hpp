@@ -1,7 +1,15 @@
 #pragma once
 #include "util/StrToHex.hpp"
 #include "PatternHash.hpp"
-
+#include "PeImage.hpp"
+#include "SignatureMatcher.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -72,6 +80,8 @@ namespace YimMenu
 		virtual const std::string_view Name() const                                      = 0;
 		virtual constexpr std::span<const std::optional<std::uint8_t>> Signature() const = 0;
 		virtual const PatternHash Hash() const                                           = 0;
+		virtual PackedSignature Packed() const                                           = 0;
+		virtual SectionClass Section() const                                             = 0;
 	};
 
 	template<Signature S>
@@ -79,11 +89,16 @@ namespace YimMenu
 	{
 	private:
 		const std::string_view m_Name;
+		const SectionClass m_Section;
 		std::array<std::optional<std::uint8_t>, S.ByteLength()> m_Signature;
+		std::array<std::uint8_t, S.ByteLength()> m_Values{};
+		std::array<std::uint8_t, S.ByteLength()> m_Masks{};
+		std::uint32_t m_Anchor;
+		std::uint32_t m_Guard;
 		PatternHash m_Hash;
 
 	public:
-		constexpr Pattern(const std::string_view name);
+		constexpr Pattern(const std::string_view name, SectionClass section = SectionClass::CODE);
 
 		inline virtual const std::string_view Name() const override
 		{
@@ -97,14 +112,33 @@ namespace YimMenu
 		{
 			return m_Hash;
 		}
+		/**
+		 * @brief The signature as value/mask pair with its anchor bytes, computed at compile time
+		 * 
+		 * @return PackedSignature 
+		 */
+		inline virtual PackedSignature Packed() const override
+		{
+			return {m_Values, m_Masks, m_Anchor, m_Guard};
+		}
+		/**
+		 * @brief The class of PE sections this pattern is searched in
+		 * 
+		 * @return SectionClass 
+		 */
+		inline virtual SectionClass Section() const override
+		{
+			return m_Section;
+		}
 
 		friend std::ostream& operator<< <>(std::ostream& os, const Pattern<S>& signature);
 	};
 
 	template<Signature S>
-	inline constexpr Pattern<S>::Pattern(const std::string_view name) :
+	inline constexpr Pattern<S>::Pattern(const std::string_view name, SectionClass section) :
 	    IPattern(),
-	    m_Name(name)
+	    m_Name(name),
+	    m_Section(section)
 	{
 		m_Hash = S.Hash();
 
@@ -127,8 +161,20 @@ namespace YimMenu
 			}
 
 
-			m_Signature[pos++] = static_cast<std::uint8_t>(StrToHex(S.Get()[i]) * 0x10 + StrToHex(S.Get()[++i]));
+			const auto high = StrToHex(S.Get()[i]);
+			const auto low  = StrToHex(S.Get()[i + 1]);
+			i += 1;
+
+			m_Signature[pos++] = static_cast<std::uint8_t>(high * 0x10 + low);
 		}
+
+		for (size_t i = 0; i < m_Signature.size(); i++)
+		{
+			m_Values[i] = m_Signature[i].value_or(0);
+			m_Masks[i]  = m_Signature[i] ? 0xFF : 0x00;
+		}
+
+		SignatureMatcher::SelectAnchors(m_Values, m_Masks, m_Anchor, m_Guard);
 	}
 
 	template<Signature S>
@@ -142,7 +188,7 @@ namespace YimMenu
 				os << "?? ";
 				continue;
 			}
-			os << std::hex << std::uppercase << DWORD64(byte.value()) << std::nouppercase << std::dec << ' ';
+			os << std::hex << std::uppercase << std::uint64_t(byte.value()) << std::nouppercase << std::dec << ' ';
 		}
 		os << "}";
 		return os;
@@ -1,15 +1,18 @@
 #pragma once
+#include <cstdint>
 
-// TODO: use an actual hash function
 namespace YimMenu
 {
+	/**
+	 * @brief 64-bit FNV-1a over everything passed to Update(), finalized with the murmur3 avalanche in GetHash()
+	 */
 	class PatternHash
 	{
 	public:
 		std::uint64_t m_Hash;
 
 		constexpr PatternHash() :
-		    m_Hash(0xD84A917A64D4D016ULL)
+		    m_Hash(0xCBF29CE484222325ULL)
 		{
 		}
 
@@ -35,34 +38,37 @@ namespace YimMenu
 
 		constexpr PatternHash Update(char data) const
 		{
-			auto hash = m_Hash;
-			hash += (static_cast<std::uint64_t>(data));
-			hash += hash << 10;
-			hash ^= (hash >> 6);
-			return PatternHash(hash);
+			return PatternHash((m_Hash ^ static_cast<std::uint8_t>(data)) * 0x100000001B3ULL);
 		}
 
 		constexpr PatternHash Update(int data) const
 		{
-			auto hash = m_Hash;
-			hash ^= (data >> 8);
-			hash += hash << 10;
-			hash ^= (hash >> 7);
-			return PatternHash(hash);
+			return Update(static_cast<std::uint64_t>(static_cast<std::uint32_t>(data)), 4);
 		}
 
 		constexpr PatternHash Update(std::uint64_t data) const
 		{
-			auto hash = m_Hash;
-			hash ^= (data * 0xA5C38736C426FCB8ULL);
-			hash += hash << 15;
-			hash ^= (hash >> 5);
-			return PatternHash(hash);
+			return Update(data, 8);
 		}
 
 		constexpr std::uint64_t GetHash() const
 		{
-			return m_Hash;
+			auto hash = m_Hash;
+			hash ^= hash >> 33;
+			hash *= 0xFF51AFD7ED558CCDULL;
+			hash ^= hash >> 33;
+			hash *= 0xC4CEB9FE1A85EC53ULL;
+			hash ^= hash >> 33;
+			return hash;
+		}
+
+	private:
+		constexpr PatternHash Update(std::uint64_t data, int bytes) const
+		{
+			auto hash = *this;
+			for (int i = 0; i < bytes; i++)
+				hash = hash.Update(static_cast<char>(data >> (i * 8)));
+			return hash;
 		}
 	};
-}
\ No newline at end of file
+}
@@ -1,10 +1,9 @@
 #include "PatternScanner.hpp"
 #include "Module.hpp"
+#include "ScanEngine.hpp"
 
 #include "core/backend/PatternCache.hpp"
 
-#include <future>
-
 namespace YimMenu
 {
 	PatternScanner::PatternScanner(const Module* module) :
@@ -15,76 +14,106 @@ namespace YimMenu
 
 	bool PatternScanner::Scan()
 	{
-		if (!m_Module || !m_Module->Valid())
-			return false;
+		std::vector<const Entry*> patterns;
+		for (const auto& entry : m_Patterns)
+			patterns.push_back(&entry);
+		return Scan(patterns);
+	}
 
-		std::vector<std::future<bool>> jobs;
-		for (const auto& [pattern, func] : m_Patterns)
+	bool PatternScanner::Scan(PatternPriority priority)
+	{
+		std::vector<const Entry*> patterns;
+		for (const auto& entry : m_Patterns)
 		{
-			jobs.emplace_back(std::async(&PatternScanner::ScanInternal, this, pattern, func));
+			if (entry.m_Priority == priority)
+				patterns.push_back(&entry);
 		}
+		return Scan(patterns);
+	}
 
-		bool scanSuccess = true;
-		for (auto& job : jobs)
-		{
-			job.wait();
+	bool PatternScanner::Scan(std::span<const Entry* const> patterns)
+	{
+		if (!m_Module || !m_Module->Valid())
+			return false;
 
-			if (scanSuccess)
-				scanSuccess = job.get();
+		const auto image = m_Module->GetImage();
+		const auto base  = reinterpret_cast<const std::uint8_t*>(m_Module->Base());
+
+		ScanEngine engine(image ? std::span(base, image->SizeOfImage()) : std::span(base, m_Module->Size()));
+		if (image)
+		{
+			engine.SetRanges(SectionClass::CODE, image->Ranges(SectionClass::CODE));
+			engine.SetRanges(SectionClass::DATA, image->Ranges(SectionClass::DATA));
 		}
-		if (!scanSuccess)
+		else
 		{
-			LOG(FATAL) << "Some patterns have not been found, continuing would be foolish.";
+			LOG(WARNING) << "Failed to parse the sections of " << m_Module->Name() << ", scanning the whole module";
 		}
-		return scanSuccess;
-	}
 
-	bool PatternScanner::ScanInternal(const IPattern* pattern, PatternFunc func) const
-	{
-		const auto signature = pattern->Signature();
-
-		if (PatternCache::IsInitialized())
+		const auto imageSize = engine.Image().size();
+		std::vector<std::pair<const IPattern*, const PatternFunc*>> pending;
+		for (const auto entry : patterns)
 		{
-			auto offset = PatternCache::GetCachedOffset(pattern->Hash().Update(m_Module->Size()));
-			if (offset.has_value())
+			const auto pattern = entry->m_Pattern;
+			const auto& func   = entry->m_Func;
+			if (PatternCache::IsInitialized())
 			{
-				LOG(INFO) << "Using cached pattern [" << pattern->Name() << "] : [" << HEX(m_Module->Base() + offset.value()) << "]";
-				std::invoke(func, m_Module->Base() + offset.value());
-				return true;
+				if (const auto offset = PatternCache::GetCachedOffset(pattern->Hash()); offset.has_value())
+				{
+					// never trust the cache blindly, the bytes at the offset have to match the signature
+					const auto packed = pattern->Packed();
+					if (offset.value() + packed.Size() <= imageSize && SignatureMatcher::Matches(packed, base + offset.value()))
+					{
+						LOG(INFO) << "Using cached pattern [" << pattern->Name() << "] : [" << HEX(m_Module->Base() + offset.value()) << "]";
+						std::invoke(func, m_Module->Base() + offset.value());
+						continue;
+					}
+
+					LOG(WARNING) << "Cached offset of pattern [" << pattern->Name() << "] is stale, rescanning";
+				}
 			}
+
+			engine.Add(pattern->Packed(), pattern->Section());
+			pending.emplace_back(pattern, &func);
 		}
 
-		for (auto i = m_Module->Base(); i < m_Module->End(); ++i)
+		bool scanSuccess = true;
+		if (!pending.empty())
 		{
-			if (signature.size() + i > m_Module->End())
-				break;
+			if (image)
+			{
+				const auto scanned = engine.BytesToScan();
+				LOG(INFO) << "Scanning " << scanned / 1024 << " KiB of " << image->SizeOfImage() / 1024 << " KiB in " << m_Module->Name()
+				          << " (" << 100 - (scanned * 100 / std::max<std::size_t>(image->SizeOfImage(), 1)) << "% skipped)";
+			}
 
-			const auto instruction = reinterpret_cast<std::uint8_t*>(i);
-			bool found             = true;
-			for (std::size_t instructionIdx = 0; instructionIdx < signature.size(); ++instructionIdx)
+			const auto results = engine.Run();
+			for (std::size_t i = 0; i < pending.size(); i++)
 			{
-				if (signature[instructionIdx] && signature[instructionIdx].value() != instruction[instructionIdx])
+				const auto [pattern, func] = pending[i];
+				if (!results[i].has_value())
 				{
-					found = false;
+					LOG(WARNING) << "Failed to find pattern [" << pattern->Name() << "]";
+					scanSuccess = false;
+					continue;
 				}
-			}
 
-			if (found)
-			{
-				LOG(INFO) << "Found pattern [" << pattern->Name() << "] : [" << HEX(i) << "]";
+				const auto address = m_Module->Base() + results[i].value();
+				LOG(INFO) << "Found pattern [" << pattern->Name() << "] : [" << HEX(address) << "]";
 
-				std::invoke(func, i);
+				std::invoke(*func, address);
 
 				if (PatternCache::IsInitialized())
 				{
-					PatternCache::UpdateCachedOffset(pattern->Hash().Update(m_Module->Size()), i - m_Module->Base());
+					PatternCache::UpdateCachedOffset(pattern->Hash(), static_cast<std::uint32_t>(results[i].value()));
 				}
-
-				return true;
 			}
 		}
 
-		LOG(WARNING) << "Failed to find pattern [" << pattern->Name() << "]";
-		return false;
+		if (!scanSuccess)
+		{
+			LOG(FATAL) << "Some patterns have not been found, continuing would be foolish.";
+		}
+		return scanSuccess;
 	}
-}
\ No newline at end of file
+}
@@ -3,6 +3,7 @@
 #include "PointerCalculator.hpp"
 
 #include <functional>
+#include <span>
 #include <vector>
 
 namespace YimMenu
@@ -10,26 +11,51 @@ namespace YimMenu
 	class Module;
 	using PatternFunc = std::function<void(PointerCalculator)>;
 
+	/**
+	 * @brief When a pattern has to be resolved during startup
+	 */
+	enum class PatternPriority
+	{
+		CRITICAL, // before anything else runs, the renderer and the native invoker depend on these
+		HOOK,     // before the hooks are created, the hooks themselves and anything their detours touch
+		LAZY      // only used by features and the GUI, resolved in the background while the renderer starts up
+	};
+
 	class PatternScanner
 	{
 	private:
+		struct Entry
+		{
+			const IPattern* m_Pattern;
+			PatternFunc m_Func;
+			PatternPriority m_Priority;
+		};
+
 		const Module* m_Module;
-		std::vector<std::pair<const IPattern*, PatternFunc>> m_Patterns;
+		std::vector<Entry> m_Patterns;
+
+		bool Scan(std::span<const Entry* const> patterns);
 
 	public:
 		PatternScanner(const Module* module);
 
 		template<Signature S>
-		void Add(const Pattern<S>& pattern, const PatternFunc& func);
+		void Add(const Pattern<S>& pattern, const PatternFunc& func, PatternPriority priority = PatternPriority::CRITICAL);
+		/**
+		 * @brief Resolves every added pattern in a single pass over the module, cached offsets are used where available
+		 * 
+		 * @return true If all patterns have been found
+		 */
 		bool Scan();
-
-	private:
-		bool ScanInternal(const IPattern* pattern, PatternFunc func) const;
+		/**
+		 * @brief Same as Scan() but only for the patterns of one priority tier
+		 */
+		bool Scan(PatternPriority priority);
 	};
 
 	template<Signature S>
-	inline void PatternScanner::Add(const Pattern<S>& pattern, const PatternFunc& func)
+	inline void PatternScanner::Add(const Pattern<S>& pattern, const PatternFunc& func, PatternPriority priority)
 	{
-		m_Patterns.push_back(std::move(std::make_pair(&pattern, func)));
+		m_Patterns.push_back({&pattern, func, priority});
 	}
 }
@@ -0,0 +1,154 @@
+#include "PeImage.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace YimMenu
+{
+	// we can't rely on winnt.h outside of Windows, these are the offsets of the few fields we need
+	static constexpr std::size_t g_DosLfanew                   = 0x3C;
+	static constexpr std::uint32_t g_NtSignature               = 0x00004550; // PE\0\0
+	static constexpr std::size_t g_FileHeaderSize              = 20;
+	static constexpr std::size_t g_SectionHeaderSize           = 40;
+	static constexpr std::uint16_t g_OptionalHeaderMagic32     = 0x10B;
+	static constexpr std::uint16_t g_OptionalHeaderMagic64     = 0x20B;
+	static constexpr std::uint32_t g_ScnCntCode                = 0x00000020;
+	static constexpr std::uint32_t g_ScnCntInitializedData     = 0x00000040;
+	static constexpr std::uint32_t g_ScnMemDiscardable         = 0x02000000;
+	static constexpr std::uint32_t g_ScnMemExecute             = 0x20000000;
+	static constexpr std::uint32_t g_ScnMemRead                = 0x40000000;
+
+	template<typename T>
+	static bool Read(std::span<const std::uint8_t> buffer, std::size_t offset, T& out)
+	{
+		if (offset + sizeof(T) > buffer.size())
+			return false;
+
+		std::memcpy(&out, buffer.data() + offset, sizeof(T));
+		return true;
+	}
+
+	bool PeSection::IsCode() const
+	{
+		return m_Characteristics & (g_ScnCntCode | g_ScnMemExecute);
+	}
+
+	bool PeSection::IsData() const
+	{
+		if (IsCode() || m_Name == ".rsrc")
+			return false;
+
+		return (m_Characteristics & g_ScnCntInitializedData) && (m_Characteristics & g_ScnMemRead) && !(m_Characteristics & g_ScnMemDiscardable);
+	}
+
+	std::optional<PeImage> PeImage::Parse(std::span<const std::uint8_t> buffer, PeLayout layout)
+	{
+		std::uint16_t dosMagic;
+		std::uint32_t ntOffset;
+		if (!Read(buffer, 0, dosMagic) || dosMagic != 0x5A4D || !Read(buffer, g_DosLfanew, ntOffset))
+			return std::nullopt;
+
+		std::uint32_t signature;
+		if (!Read(buffer, ntOffset, signature) || signature != g_NtSignature)
+			return std::nullopt;
+
+		const auto fileHeader = ntOffset + 4;
+		std::uint16_t numberOfSections, sizeOfOptionalHeader;
+		PeImage image;
+		if (!Read(buffer, fileHeader + 2, numberOfSections) || !Read(buffer, fileHeader + 4, image.m_TimeDateStamp)
+		    || !Read(buffer, fileHeader + 16, sizeOfOptionalHeader))
+			return std::nullopt;
+
+		const auto optionalHeader = fileHeader + g_FileHeaderSize;
+		std::uint16_t magic;
+		if (!Read(buffer, optionalHeader, magic) || (magic != g_OptionalHeaderMagic32 && magic != g_OptionalHeaderMagic64))
+			return std::nullopt;
+
+		// these are at the same offset in both the 32 and 64 bit optional header
+		if (!Read(buffer, optionalHeader + 4, image.m_SizeOfCode) || !Read(buffer, optionalHeader + 56, image.m_SizeOfImage)
+		    || !Read(buffer, optionalHeader + 64, image.m_CheckSum))
+			return std::nullopt;
+
+		const auto sectionTable = optionalHeader + sizeOfOptionalHeader;
+		for (std::size_t i = 0; i < numberOfSections; i++)
+		{
+			const auto header = sectionTable + i * g_SectionHeaderSize;
+			if (header + g_SectionHeaderSize > buffer.size())
+				return std::nullopt;
+
+			PeSection section{};
+			const auto name = reinterpret_cast<const char*>(buffer.data() + header);
+			section.m_Name  = std::string(name, strnlen(name, 8));
+			Read(buffer, header + 8, section.m_VirtualSize);
+			Read(buffer, header + 12, section.m_VirtualAddress);
+			Read(buffer, header + 16, section.m_RawSize);
+			Read(buffer, header + 20, section.m_RawOffset);
+			Read(buffer, header + 36, section.m_Characteristics);
+			image.m_Sections.push_back(std::move(section));
+		}
+
+		image.m_BufferSize = buffer.size();
+		image.m_Layout     = layout;
+		return image;
+	}
+
+	PeImage::Range PeImage::SectionRange(const PeSection& section) const
+	{
+		std::size_t begin, size;
+		if (m_Layout == PeLayout::MAPPED)
+		{
+			begin = section.m_VirtualAddress;
+			size  = section.m_VirtualSize ? section.m_VirtualSize : section.m_RawSize;
+		}
+		else
+		{
+			begin = section.m_RawOffset;
+			size  = section.m_VirtualSize ? std::min(section.m_VirtualSize, section.m_RawSize) : section.m_RawSize;
+		}
+
+		begin = std::min(begin, m_BufferSize);
+		return {begin, std::min(begin + size, m_BufferSize)};
+	}
+
+	std::vector<PeImage::Range> PeImage::Ranges(SectionClass sectionClass) const
+	{
+		std::vector<Range> ranges;
+		for (const auto& section : m_Sections)
+		{
+			if (sectionClass == SectionClass::CODE ? !section.IsCode() : !section.IsData())
+				continue;
+
+			if (const auto range = SectionRange(section); range.Size())
+				ranges.push_back(range);
+		}
+
+		std::ranges::sort(ranges, {}, &Range::m_Begin);
+		return ranges;
+	}
+
+	std::optional<std::size_t> PeImage::RvaToOffset(std::uint32_t rva) const
+	{
+		if (m_Layout == PeLayout::MAPPED)
+			return rva < m_BufferSize ? std::optional<std::size_t>(rva) : std::nullopt;
+
+		for (const auto& section : m_Sections)
+		{
+			if (rva >= section.m_VirtualAddress && rva - section.m_VirtualAddress < section.m_RawSize)
+				return section.m_RawOffset + (rva - section.m_VirtualAddress);
+		}
+		return std::nullopt;
+	}
+
+	std::optional<std::uint32_t> PeImage::OffsetToRva(std::size_t offset) const
+	{
+		if (m_Layout == PeLayout::MAPPED)
+			return offset < m_BufferSize ? std::optional<std::uint32_t>(static_cast<std::uint32_t>(offset)) : std::nullopt;
+
+		for (const auto& section : m_Sections)
+		{
+			if (offset >= section.m_RawOffset && offset - section.m_RawOffset < section.m_RawSize)
+				return static_cast<std::uint32_t>(section.m_VirtualAddress + (offset - section.m_RawOffset));
+		}
+		return std::nullopt;
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace YimMenu
+{
+	enum class SectionClass
+	{
+		CODE, // executable sections (.text and friends)
+		DATA  // initialized, readable data (.rdata, .data)
+	};
+
+	enum class PeLayout
+	{
+		MAPPED, // loaded by the OS loader, sections live at their RVA
+		FILE    // raw on-disk image, sections live at their raw data pointer
+	};
+
+	struct PeSection
+	{
+		std::string m_Name;
+		std::uint32_t m_VirtualAddress;
+		std::uint32_t m_VirtualSize;
+		std::uint32_t m_RawOffset;
+		std::uint32_t m_RawSize;
+		std::uint32_t m_Characteristics;
+
+		bool IsCode() const;
+		bool IsData() const;
+	};
+
+	/**
+	 * @brief Portable PE header and section table parser, works on both mapped modules and files read from disk
+	 */
+	class PeImage
+	{
+	public:
+		struct Range
+		{
+			std::size_t m_Begin;
+			std::size_t m_End;
+
+			std::size_t Size() const
+			{
+				return m_End - m_Begin;
+			}
+		};
+
+		/**
+		 * @brief Parses the headers of a PE image
+		 *
+		 * @param buffer The whole image, a mapped module or the contents of the file on disk
+		 * @param layout How the sections are laid out in the buffer
+		 * @return std::optional<PeImage> Nothing if the headers are invalid or truncated
+		 */
+		static std::optional<PeImage> Parse(std::span<const std::uint8_t> buffer, PeLayout layout);
+
+		const std::vector<PeSection>& Sections() const
+		{
+			return m_Sections;
+		}
+
+		std::uint32_t TimeDateStamp() const
+		{
+			return m_TimeDateStamp;
+		}
+
+		std::uint32_t CheckSum() const
+		{
+			return m_CheckSum;
+		}
+
+		std::uint32_t SizeOfImage() const
+		{
+			return m_SizeOfImage;
+		}
+
+		std::uint32_t SizeOfCode() const
+		{
+			return m_SizeOfCode;
+		}
+
+		/**
+		 * @brief Buffer ranges of all sections of the given class, sorted and clipped to the buffer
+		 */
+		std::vector<Range> Ranges(SectionClass sectionClass) const;
+
+		std::optional<std::size_t> RvaToOffset(std::uint32_t rva) const;
+		std::optional<std::uint32_t> OffsetToRva(std::size_t offset) const;
+
+	private:
+		PeImage() = default;
+
+		Range SectionRange(const PeSection& section) const;
+
+		std::size_t m_BufferSize;
+		PeLayout m_Layout;
+		std::vector<PeSection> m_Sections;
+		std::uint32_t m_TimeDateStamp;
+		std::uint32_t m_CheckSum;
+		std::uint32_t m_SizeOfImage;
+		std::uint32_t m_SizeOfCode;
+	};
+}
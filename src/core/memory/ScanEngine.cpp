@@ -0,0 +1,280 @@
+#include "ScanEngine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace YimMenu
+{
+	static constexpr std::size_t g_BucketCount       = 0x10000;
+	static constexpr std::size_t g_MinChunkSize      = 0x100000;
+	static constexpr std::size_t g_DirectSearchLimit = 16; // up to this many signatures one vectorized pass each beats the anchor index
+	static constexpr auto g_NotFound                 = std::numeric_limits<std::size_t>::max();
+
+	ScanEngine::ScanEngine(std::span<const std::uint8_t> image) :
+	    m_Image(image),
+	    m_Backend(SignatureMatcher::GetBestBackend())
+	{
+		for (auto& ranges : m_Ranges)
+			ranges = {{0, image.size()}};
+	}
+
+	void ScanEngine::SetRanges(SectionClass sectionClass, std::vector<PeImage::Range> ranges)
+	{
+		std::ranges::sort(ranges, {}, &PeImage::Range::m_Begin);
+		m_Ranges[static_cast<int>(sectionClass)] = std::move(ranges);
+	}
+
+	std::size_t ScanEngine::BytesToScan() const
+	{
+		std::size_t bytes = 0;
+		for (auto sectionClass : {SectionClass::CODE, SectionClass::DATA})
+		{
+			if (std::ranges::none_of(m_Signatures, [sectionClass](const CompiledSignature& signature) {
+				    return signature.m_Class == sectionClass;
+			    }))
+				continue;
+
+			for (const auto& range : m_Ranges[static_cast<int>(sectionClass)])
+				bytes += range.Size();
+		}
+		return bytes;
+	}
+
+	std::size_t ScanEngine::Add(std::span<const std::optional<std::uint8_t>> signature, SectionClass sectionClass)
+	{
+		std::vector<std::uint8_t> values, masks;
+		for (const auto& byte : signature)
+		{
+			values.push_back(byte.value_or(0));
+			masks.push_back(byte ? 0xFF : 0x00);
+		}
+
+		PackedSignature packed{values, masks, 0, 0};
+		SignatureMatcher::SelectAnchors(values, masks, packed.m_Anchor, packed.m_Guard);
+		return Add(packed, sectionClass);
+	}
+
+	std::size_t ScanEngine::Add(const PackedSignature& signature, SectionClass sectionClass)
+	{
+		CompiledSignature compiled{m_Values.size(), signature.Size(), std::nullopt, false, signature.m_Anchor, signature.m_Guard, sectionClass};
+
+		m_Values.insert(m_Values.end(), signature.m_Values.begin(), signature.m_Values.end());
+		m_Masks.insert(m_Masks.end(), signature.m_Masks.begin(), signature.m_Masks.end());
+
+		// index the rarest pair of adjacent fixed bytes
+		int bestFrequency = INT32_MAX;
+		for (std::uint32_t i = 0; i + 1 < signature.Size(); i++)
+		{
+			if (!signature.m_Masks[i] || !signature.m_Masks[i + 1])
+				continue;
+
+			const auto frequency = SignatureMatcher::ByteFrequency(signature.m_Values[i]) + SignatureMatcher::ByteFrequency(signature.m_Values[i + 1]);
+			if (frequency < bestFrequency)
+			{
+				compiled.m_AnchorOffset = i;
+				bestFrequency           = frequency;
+			}
+		}
+
+		// no two adjacent fixed bytes, index the rarest fixed byte under every possible successor
+		if (!compiled.m_AnchorOffset && signature.Size() && signature.m_Masks[signature.m_Anchor])
+		{
+			compiled.m_AnchorOffset = signature.m_Anchor;
+			compiled.m_HalfAnchor   = true;
+		}
+
+		m_Signatures.push_back(compiled);
+		return m_Signatures.size() - 1;
+	}
+
+	void ScanEngine::BuildIndex(Index& index, SectionClass sectionClass) const
+	{
+		auto& bucketStart = index.m_BucketStart;
+		auto& anchors     = index.m_Anchors;
+
+		const auto forEachKey = [this](const CompiledSignature& signature, auto&& func) {
+			const auto low = m_Values[signature.m_Start + *signature.m_AnchorOffset];
+			if (signature.m_HalfAnchor)
+			{
+				for (std::uint32_t high = 0; high < 0x100; high++)
+					func(low | (high << 8));
+			}
+			else
+			{
+				func(low | (m_Values[signature.m_Start + *signature.m_AnchorOffset + 1] << 8));
+			}
+		};
+
+		// counting sort into a flat bucket array, bucketStart[key]..bucketStart[key + 1] holds the anchors of key
+		bucketStart.assign(g_BucketCount + 1, 0);
+		index.m_MaxAnchorOffset = 0;
+		for (const auto& signature : m_Signatures)
+		{
+			if (!signature.m_AnchorOffset || signature.m_Class != sectionClass)
+				continue;
+
+			index.m_MaxAnchorOffset = std::max(index.m_MaxAnchorOffset, *signature.m_AnchorOffset);
+			forEachKey(signature, [&](std::uint32_t key) {
+				bucketStart[key + 1]++;
+			});
+		}
+
+		for (std::size_t i = 0; i < g_BucketCount; i++)
+			bucketStart[i + 1] += bucketStart[i];
+
+		anchors.resize(bucketStart[g_BucketCount]);
+		auto fill = bucketStart;
+		for (std::uint32_t i = 0; i < m_Signatures.size(); i++)
+		{
+			const auto& signature = m_Signatures[i];
+			if (signature.m_AnchorOffset && signature.m_Class == sectionClass)
+				forEachKey(signature, [&](std::uint32_t key) {
+					anchors[fill[key]++] = {i, *signature.m_AnchorOffset};
+				});
+		}
+	}
+
+	bool ScanEngine::Matches(const CompiledSignature& signature, std::size_t offset) const
+	{
+		if (offset + signature.m_Length > m_Image.size())
+			return false;
+
+		return SignatureMatcher::Matches(Pack(signature), m_Image.data() + offset, m_Backend);
+	}
+
+	PackedSignature ScanEngine::Pack(const CompiledSignature& signature) const
+	{
+		return {{m_Values.data() + signature.m_Start, signature.m_Length}, {m_Masks.data() + signature.m_Start, signature.m_Length}, signature.m_Anchor, signature.m_Guard};
+	}
+
+	std::vector<std::optional<std::size_t>> ScanEngine::RunDirect() const
+	{
+		std::vector<std::optional<std::size_t>> results;
+		for (const auto& signature : m_Signatures)
+		{
+			auto& result = results.emplace_back();
+			for (const auto& range : m_Ranges[static_cast<int>(signature.m_Class)])
+			{
+				// a match belongs to the range its first byte is in and may run past the range end, ScanIndexed follows the same rule
+				const auto end = std::min(range.m_End + std::max<std::size_t>(signature.m_Length, 1) - 1, m_Image.size());
+				if (const auto offset = SignatureMatcher::FindFirst(m_Image.subspan(range.m_Begin, end - range.m_Begin), Pack(signature), m_Backend))
+				{
+					result = range.m_Begin + offset.value();
+					break;
+				}
+			}
+		}
+		return results;
+	}
+
+	template<typename F>
+	void ScanEngine::ScanIndexed(unsigned maxThreads, F&& visit) const
+	{
+		std::array<Index, 2> indices;
+		for (auto sectionClass : {SectionClass::CODE, SectionClass::DATA})
+			BuildIndex(indices[static_cast<int>(sectionClass)], sectionClass);
+
+		if (!maxThreads)
+			maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		// split every range into roughly equal chunks, workers pull them until none are left
+		const auto chunkSize = std::max(g_MinChunkSize, BytesToScan() / maxThreads + 1);
+		std::vector<Chunk> chunks;
+		for (auto sectionClass : {SectionClass::CODE, SectionClass::DATA})
+		{
+			const auto& index = indices[static_cast<int>(sectionClass)];
+			if (index.m_Anchors.empty())
+				continue;
+
+			for (const auto& range : m_Ranges[static_cast<int>(sectionClass)])
+			{
+				for (auto begin = range.m_Begin; begin < range.m_End; begin += chunkSize)
+					chunks.push_back({&index, begin, std::min(begin + chunkSize, range.m_End)});
+			}
+		}
+
+		const auto scanChunk = [&](const Chunk& chunk) {
+			const auto image        = m_Image.data();
+			const auto size         = m_Image.size();
+			const auto& bucketStart = chunk.m_Index->m_BucketStart;
+			const auto& anchors     = chunk.m_Index->m_Anchors;
+
+			// a chunk owns the matches that start inside it, so keep walking past its end until the anchors of those are covered
+			const auto end = std::min(chunk.m_End + chunk.m_Index->m_MaxAnchorOffset, size);
+			for (auto i = chunk.m_Begin; i < end; i++)
+			{
+				std::uint32_t key = image[i];
+				if (i + 1 < size)
+					key |= image[i + 1] << 8;
+
+				for (auto j = bucketStart[key]; j < bucketStart[key + 1]; j++)
+				{
+					const auto& anchor = anchors[j];
+					if (i >= chunk.m_Begin + anchor.m_Offset && i < chunk.m_End + anchor.m_Offset)
+						visit(anchor.m_Signature, i - anchor.m_Offset);
+				}
+			}
+		};
+
+		std::atomic<std::size_t> nextChunk = 0;
+		const auto worker = [&] {
+			for (auto chunk = nextChunk++; chunk < chunks.size(); chunk = nextChunk++)
+				scanChunk(chunks[chunk]);
+		};
+
+		std::vector<std::jthread> workers;
+		for (std::size_t i = 1; i < std::min<std::size_t>(maxThreads, chunks.size()); i++)
+			workers.emplace_back(worker);
+		worker();
+	}
+
+	std::vector<std::optional<std::size_t>> ScanEngine::Run(unsigned maxThreads) const
+	{
+		if (m_Signatures.size() <= g_DirectSearchLimit)
+			return RunDirect();
+
+		std::vector<std::atomic<std::size_t>> best(m_Signatures.size());
+		for (std::size_t i = 0; i < m_Signatures.size(); i++)
+			best[i] = m_Signatures[i].m_AnchorOffset ? g_NotFound : 0; // a signature without fixed bytes matches anywhere
+
+		ScanIndexed(maxThreads, [&](std::uint32_t signature, std::size_t offset) {
+			auto& found  = best[signature];
+			auto current = found.load(std::memory_order_relaxed);
+			if (offset >= current || !Matches(m_Signatures[signature], offset))
+				return;
+
+			while (offset < current && !found.compare_exchange_weak(current, offset, std::memory_order_relaxed))
+				;
+		});
+
+		std::vector<std::optional<std::size_t>> results(m_Signatures.size());
+		for (std::size_t i = 0; i < m_Signatures.size(); i++)
+		{
+			if (const auto offset = best[i].load(); offset != g_NotFound)
+				results[i] = offset;
+		}
+		return results;
+	}
+
+	std::vector<std::vector<std::size_t>> ScanEngine::RunAll(unsigned maxThreads) const
+	{
+		std::vector<std::vector<std::size_t>> results(m_Signatures.size());
+		std::mutex mutex;
+
+		ScanIndexed(maxThreads, [&](std::uint32_t signature, std::size_t offset) {
+			if (!Matches(m_Signatures[signature], offset))
+				return;
+
+			std::lock_guard lock(mutex);
+			results[signature].push_back(offset);
+		});
+
+		for (auto& matches : results)
+			std::ranges::sort(matches);
+		return results;
+	}
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "PeImage.hpp"
+#include "SignatureMatcher.hpp"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Matches any number of signatures against a single image in one pass.
+	 *
+	 * Every signature is indexed by an anchor (its rarest two adjacent non-wildcard bytes), so walking the image
+	 * only costs one table lookup per byte no matter how many signatures are registered. The image is split into
+	 * a small fixed number of chunks which are scanned in parallel, and the lowest matching offset wins.
+	 * A handful of signatures is cheaper to find one by one with the vectorized SignatureMatcher::FindFirst.
+	 * Signatures are only matched inside the ranges of their section class, the whole image by default.
+	 * A match counts when its first byte lies inside a range, the remaining bytes may run past the range end.
+	 */
+	class ScanEngine
+	{
+	public:
+		ScanEngine(std::span<const std::uint8_t> image);
+
+		/**
+		 * @brief Registers a signature to be matched by the next Run()
+		 *
+		 * @return std::size_t Index of the signature in the result vector
+		 */
+		std::size_t Add(std::span<const std::optional<std::uint8_t>> signature, SectionClass sectionClass = SectionClass::CODE);
+		std::size_t Add(const PackedSignature& signature, SectionClass sectionClass = SectionClass::CODE);
+
+		/**
+		 * @brief Restricts signatures of a section class to the given ranges of the image
+		 */
+		void SetRanges(SectionClass sectionClass, std::vector<PeImage::Range> ranges);
+
+		/**
+		 * @brief Amount of bytes the next Run() will walk
+		 */
+		std::size_t BytesToScan() const;
+
+		/**
+		 * @brief Scans the image for every registered signature
+		 *
+		 * @param maxThreads Upper bound for the amount of chunks scanned in parallel, 0 picks one per hardware thread
+		 * @return std::vector<std::optional<std::size_t>> Lowest matching offset per signature, in registration order
+		 */
+		std::vector<std::optional<std::size_t>> Run(unsigned maxThreads = 0) const;
+
+		/**
+		 * @brief Analysis mode, collects every match instead of stopping at the first one
+		 *
+		 * Signatures without any fixed byte are skipped since they would match everywhere.
+		 * 
+		 * @return std::vector<std::vector<std::size_t>> Sorted offsets of all matches per signature, in registration order
+		 */
+		std::vector<std::vector<std::size_t>> RunAll(unsigned maxThreads = 0) const;
+
+		std::span<const PeImage::Range> Ranges(SectionClass sectionClass) const
+		{
+			return m_Ranges[static_cast<int>(sectionClass)];
+		}
+
+		std::span<const std::uint8_t> Image() const
+		{
+			return m_Image;
+		}
+
+		void SetBackend(MatcherBackend backend)
+		{
+			m_Backend = backend;
+		}
+
+	private:
+		struct Anchor
+		{
+			std::uint32_t m_Signature;
+			std::uint32_t m_Offset;
+		};
+
+		struct CompiledSignature
+		{
+			std::size_t m_Start;  // into m_Values/m_Masks
+			std::size_t m_Length;
+			std::optional<std::uint32_t> m_AnchorOffset;
+			bool m_HalfAnchor; // only the first anchor byte is fixed
+			std::uint32_t m_Anchor;
+			std::uint32_t m_Guard;
+			SectionClass m_Class;
+		};
+
+		struct Index
+		{
+			std::vector<std::uint32_t> m_BucketStart;
+			std::vector<Anchor> m_Anchors;
+			std::uint32_t m_MaxAnchorOffset;
+		};
+
+		struct Chunk
+		{
+			const Index* m_Index;
+			std::size_t m_Begin;
+			std::size_t m_End;
+		};
+
+		void BuildIndex(Index& index, SectionClass sectionClass) const;
+		template<typename F>
+		void ScanIndexed(unsigned maxThreads, F&& visit) const;
+		std::vector<std::optional<std::size_t>> RunDirect() const;
+		bool Matches(const CompiledSignature& signature, std::size_t offset) const;
+		PackedSignature Pack(const CompiledSignature& signature) const;
+
+		std::span<const std::uint8_t> m_Image;
+		std::vector<CompiledSignature> m_Signatures;
+		std::vector<std::uint8_t> m_Values;
+		std::vector<std::uint8_t> m_Masks;
+		std::array<std::vector<PeImage::Range>, 2> m_Ranges;
+		MatcherBackend m_Backend;
+	};
+}
@@ -0,0 +1,172 @@
+#include "SignatureAnalyzer.hpp"
+#include "ScanEngine.hpp"
+
+#include <algorithm>
+
+
+namespace YimMenu::SignatureAnalyzer
+{
+	static constexpr std::size_t g_MaxReportedMatches = 16;
+
+	static PackedSignature PackPrefix(std::span<const std::uint8_t> values, std::span<const std::uint8_t> masks, std::size_t length)
+	{
+		PackedSignature packed{values.first(length), masks.first(length), 0, 0};
+		SignatureMatcher::SelectAnchors(packed.m_Values, packed.m_Masks, packed.m_Anchor, packed.m_Guard);
+		return packed;
+	}
+
+	// whether a signature matches exactly once inside the ranges
+	static bool IsUnique(std::span<const std::uint8_t> buffer, std::span<const PeImage::Range> ranges, const PackedSignature& signature)
+	{
+		std::size_t matches = 0;
+		for (const auto& range : ranges)
+		{
+			const auto end = std::min(range.m_End + std::max<std::size_t>(signature.Size(), 1) - 1, buffer.size());
+			for (auto begin = range.m_Begin; begin < end;)
+			{
+				const auto offset = SignatureMatcher::FindFirst(buffer.subspan(begin, end - begin), signature);
+				if (!offset)
+					break;
+
+				if (++matches > 1)
+					return false;
+				begin += offset.value() + 1;
+			}
+		}
+		return matches == 1;
+	}
+
+	static std::optional<std::string> ShortestUniquePrefix(std::span<const std::uint8_t> buffer, std::span<const PeImage::Range> ranges, const PackedSignature& signature)
+	{
+		// uniqueness only ever improves with length, so binary search the shortest unique prefix. A prefix of only
+		// wildcards has nothing to anchor on, the search starts at the first fixed byte
+		const auto first_fixed = std::ranges::find_if(signature.m_Masks, [](std::uint8_t mask) {
+			return mask != 0;
+		}) - signature.m_Masks.begin();
+
+		std::size_t low = first_fixed + 1, high = signature.Size();
+		while (low < high)
+		{
+			const auto mid = (low + high) / 2;
+			if (IsUnique(buffer, ranges, PackPrefix(signature.m_Values, signature.m_Masks, mid)))
+				high = mid;
+			else
+				low = mid + 1;
+		}
+
+		// trailing wildcards don't add anything
+		while (high > 1 && !signature.m_Masks[high - 1])
+			high--;
+
+		if (high >= signature.Size())
+			return std::nullopt;
+		return FormatSignature(signature.m_Values.first(high), signature.m_Masks.first(high));
+	}
+
+	static std::optional<std::string> ShortestUniqueExtension(std::span<const std::uint8_t> buffer, const PackedSignature& signature, std::vector<std::size_t> candidates, std::size_t maxExtension)
+	{
+		const auto target = candidates.front();
+		std::vector<std::uint8_t> values(signature.m_Values.begin(), signature.m_Values.end());
+		std::vector<std::uint8_t> masks(signature.m_Masks.begin(), signature.m_Masks.end());
+
+		for (std::size_t extension = 0; extension < maxExtension && candidates.size() > 1; extension++)
+		{
+			const auto position = values.size();
+			if (target + position >= buffer.size())
+				return std::nullopt;
+
+			const auto byte = buffer[target + position];
+			values.push_back(byte);
+			masks.push_back(0xFF);
+
+			std::erase_if(candidates, [&](std::size_t candidate) {
+				return candidate != target && (candidate + position >= buffer.size() || buffer[candidate + position] != byte);
+			});
+		}
+
+		if (candidates.size() > 1)
+			return std::nullopt;
+		return FormatSignature(values, masks);
+	}
+
+	std::vector<Report> Analyze(std::span<const std::uint8_t> buffer, const PeImage* image, std::span<const IPattern* const> patterns, std::size_t maxExtension)
+	{
+		ScanEngine engine(buffer);
+		if (image)
+		{
+			engine.SetRanges(SectionClass::CODE, image->Ranges(SectionClass::CODE));
+			engine.SetRanges(SectionClass::DATA, image->Ranges(SectionClass::DATA));
+		}
+
+		for (const auto pattern : patterns)
+			engine.Add(pattern->Packed(), pattern->Section());
+
+		auto matches = engine.RunAll();
+
+		std::vector<Report> reports;
+		for (std::size_t i = 0; i < patterns.size(); i++)
+		{
+			auto& report     = reports.emplace_back();
+			report.m_Pattern = patterns[i];
+			report.m_Matches = std::move(matches[i]);
+
+			const auto packed = patterns[i]->Packed();
+			if (report.Ambiguous())
+				report.m_Proposal = ShortestUniqueExtension(buffer, packed, report.m_Matches, maxExtension);
+			else if (!report.m_Matches.empty())
+				report.m_Proposal = ShortestUniquePrefix(buffer, engine.Ranges(patterns[i]->Section()), packed);
+		}
+		return reports;
+	}
+
+	std::string FormatSignature(std::span<const std::uint8_t> values, std::span<const std::uint8_t> masks)
+	{
+		static constexpr char digits[] = "0123456789ABCDEF";
+
+		std::string signature;
+		for (std::size_t i = 0; i < values.size(); i++)
+		{
+			if (i)
+				signature += ' ';
+
+			if (!masks[i])
+			{
+				signature += '?';
+				continue;
+			}
+			signature += digits[values[i] >> 4];
+			signature += digits[values[i] & 0xF];
+		}
+		return signature;
+	}
+
+	std::string ToJson(std::span<const Report> reports, const PeImage* image)
+	{
+		// names and signatures never contain characters that need escaping
+		std::string json = "[\n";
+		for (std::size_t i = 0; i < reports.size(); i++)
+		{
+			const auto& report = reports[i];
+			const auto packed  = report.m_Pattern->Packed();
+
+			json += "  {";
+			json += "\"name\": \"" + std::string(report.m_Pattern->Name()) + "\", ";
+			json += "\"signature\": \"" + FormatSignature(packed.m_Values, packed.m_Masks) + "\", ";
+			json += "\"matches\": " + std::to_string(report.m_Matches.size()) + ", ";
+			json += "\"ambiguous\": " + std::string(report.Ambiguous() ? "true" : "false") + ", ";
+
+			json += "\"rvas\": [";
+			for (std::size_t j = 0; j < std::min(report.m_Matches.size(), g_MaxReportedMatches); j++)
+			{
+				const auto rva = image ? image->OffsetToRva(report.m_Matches[j]) : std::optional<std::uint32_t>(static_cast<std::uint32_t>(report.m_Matches[j]));
+				json += (j ? ", " : "") + (rva ? std::to_string(*rva) : "null");
+			}
+			json += "], ";
+
+			json += "\"proposal\": " + (report.m_Proposal ? "\"" + *report.m_Proposal + "\"" : "null");
+			json += i + 1 < reports.size() ? "},\n" : "}\n";
+		}
+		json += "]\n";
+		return json;
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "Pattern.hpp"
+#include "PeImage.hpp"
+
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace YimMenu::SignatureAnalyzer
+{
+	struct Report
+	{
+		const IPattern* m_Pattern;
+		std::vector<std::size_t> m_Matches; // buffer offsets, sorted
+		// the shortest unique prefix of a unique signature, or the shortest unique extension of an ambiguous one
+		std::optional<std::string> m_Proposal;
+
+		bool Ambiguous() const
+		{
+			return m_Matches.size() > 1;
+		}
+	};
+
+	/**
+	 * @brief Counts every match of each pattern and proposes shorter (unique) or longer (ambiguous) signatures
+	 *
+	 * Extensions append the bytes following the first match, which is the one the scanner resolves to, and keep
+	 * all wildcards of the original signature.
+	 *
+	 * @param buffer The image to analyze
+	 * @param image Its PE headers, restricts patterns to their section class. Without them the whole buffer is used
+	 * @param maxExtension Upper bound for the amount of bytes appended to an ambiguous signature
+	 */
+	std::vector<Report> Analyze(std::span<const std::uint8_t> buffer, const PeImage* image, std::span<const IPattern* const> patterns, std::size_t maxExtension = 64);
+
+	/**
+	 * @brief Formats a value/mask pair the way signatures are written in Patterns.hpp
+	 */
+	std::string FormatSignature(std::span<const std::uint8_t> values, std::span<const std::uint8_t> masks);
+
+	/**
+	 * @brief Machine readable report: one object per pattern with its match count, RVAs and proposal
+	 */
+	std::string ToJson(std::span<const Report> reports, const PeImage* image);
+}
@@ -0,0 +1,185 @@
+#include "SignatureMatcher.hpp"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define MATCHER_X64
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define MATCHER_TARGET_AVX2
+#else
+#define MATCHER_TARGET_AVX2 __attribute__((target("avx2,bmi")))
+#endif
+#endif
+
+namespace YimMenu::SignatureMatcher
+{
+	static inline unsigned CountTrailingZeros(std::uint32_t value)
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, value);
+		return index;
+#else
+		return __builtin_ctz(value);
+#endif
+	}
+
+	static bool MatchesScalar(const PackedSignature& signature, const std::uint8_t* data, std::size_t start)
+	{
+		for (auto i = start; i < signature.Size(); i++)
+		{
+			if ((data[i] & signature.m_Masks[i]) != signature.m_Values[i])
+				return false;
+		}
+		return true;
+	}
+
+	static std::optional<std::size_t> FindFirstScalar(std::span<const std::uint8_t> image, const PackedSignature& signature, std::size_t start)
+	{
+		const auto anchor = signature.m_Values[signature.m_Anchor];
+		for (auto i = start; i + signature.Size() <= image.size(); i++)
+		{
+			if (image[i + signature.m_Anchor] == anchor && MatchesScalar(signature, image.data() + i, 0))
+				return i;
+		}
+		return std::nullopt;
+	}
+
+#ifdef MATCHER_X64
+	static bool MatchesSSE2(const PackedSignature& signature, const std::uint8_t* data)
+	{
+		std::size_t i = 0;
+		for (; i + 16 <= signature.Size(); i += 16)
+		{
+			const auto bytes  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+			const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(signature.m_Values.data() + i));
+			const auto masks  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(signature.m_Masks.data() + i));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, masks), values)) != 0xFFFF)
+				return false;
+		}
+		return MatchesScalar(signature, data, i);
+	}
+
+	MATCHER_TARGET_AVX2 static bool MatchesAVX2(const PackedSignature& signature, const std::uint8_t* data)
+	{
+		std::size_t i = 0;
+		for (; i + 32 <= signature.Size(); i += 32)
+		{
+			const auto bytes  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+			const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(signature.m_Values.data() + i));
+			const auto masks  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(signature.m_Masks.data() + i));
+			if (static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(bytes, masks), values))) != 0xFFFFFFFF)
+				return false;
+		}
+		return MatchesSSE2({signature.m_Values.subspan(i), signature.m_Masks.subspan(i), 0, 0}, data + i);
+	}
+
+	static std::optional<std::size_t> FindFirstSSE2(std::span<const std::uint8_t> image, const PackedSignature& signature)
+	{
+		const auto data   = image.data();
+		const auto last   = image.size() - signature.Size(); // last valid start offset
+		const auto anchor = _mm_set1_epi8(static_cast<char>(signature.m_Values[signature.m_Anchor]));
+		const auto guard  = _mm_set1_epi8(static_cast<char>(signature.m_Values[signature.m_Guard]));
+
+		std::size_t i = 0;
+		for (; i + 16 <= last + 1; i += 16)
+		{
+			const auto anchorBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + signature.m_Anchor));
+			const auto guardBytes  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + signature.m_Guard));
+			auto candidates = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(anchorBytes, anchor), _mm_cmpeq_epi8(guardBytes, guard))));
+
+			while (candidates)
+			{
+				const auto offset = i + CountTrailingZeros(candidates);
+				if (MatchesSSE2(signature, data + offset))
+					return offset;
+				candidates &= candidates - 1;
+			}
+		}
+		return FindFirstScalar(image, signature, i);
+	}
+
+	MATCHER_TARGET_AVX2 static std::optional<std::size_t> FindFirstAVX2(std::span<const std::uint8_t> image, const PackedSignature& signature)
+	{
+		const auto data   = image.data();
+		const auto last   = image.size() - signature.Size();
+		const auto anchor = _mm256_set1_epi8(static_cast<char>(signature.m_Values[signature.m_Anchor]));
+		const auto guard  = _mm256_set1_epi8(static_cast<char>(signature.m_Values[signature.m_Guard]));
+
+		std::size_t i = 0;
+		for (; i + 32 <= last + 1; i += 32)
+		{
+			const auto anchorBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + signature.m_Anchor));
+			const auto guardBytes  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + signature.m_Guard));
+			auto candidates = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(anchorBytes, anchor), _mm256_cmpeq_epi8(guardBytes, guard))));
+
+			while (candidates)
+			{
+				const auto offset = i + CountTrailingZeros(candidates);
+				if (MatchesAVX2(signature, data + offset))
+					return offset;
+				candidates &= candidates - 1;
+			}
+		}
+		return FindFirstScalar(image, signature, i);
+	}
+
+	static bool CpuSupportsAVX2()
+	{
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 1);
+		const bool osxsave = info[2] & (1 << 27);
+		const bool avx     = info[2] & (1 << 28);
+		if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+			return false;
+
+		__cpuidex(info, 7, 0);
+		return info[1] & (1 << 5);
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+#endif
+
+	MatcherBackend GetBestBackend()
+	{
+#ifdef MATCHER_X64
+		static const auto backend = CpuSupportsAVX2() ? MatcherBackend::AVX2 : MatcherBackend::SSE2;
+		return backend;
+#else
+		return MatcherBackend::SCALAR;
+#endif
+	}
+
+	bool Matches(const PackedSignature& signature, const std::uint8_t* data, MatcherBackend backend)
+	{
+		switch (backend)
+		{
+#ifdef MATCHER_X64
+		case MatcherBackend::AVX2: return MatchesAVX2(signature, data);
+		case MatcherBackend::SSE2: return MatchesSSE2(signature, data);
+#endif
+		default: return MatchesScalar(signature, data, 0);
+		}
+	}
+
+	std::optional<std::size_t> FindFirst(std::span<const std::uint8_t> image, const PackedSignature& signature, MatcherBackend backend)
+	{
+		if (signature.Size() > image.size())
+			return std::nullopt;
+
+		// nothing to anchor on, a signature made of wildcards matches anywhere
+		if (signature.Size() == 0 || !signature.m_Masks[signature.m_Anchor])
+			return 0;
+
+		switch (backend)
+		{
+#ifdef MATCHER_X64
+		case MatcherBackend::AVX2: return FindFirstAVX2(image, signature);
+		case MatcherBackend::SSE2: return FindFirstSSE2(image, signature);
+#endif
+		default: return FindFirstScalar(image, signature, 0);
+		}
+	}
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace YimMenu
+{
+	/**
+	 * @brief A signature compiled into a value/mask pair, wildcards have a mask (and value) of 0
+	 */
+	struct PackedSignature
+	{
+		std::span<const std::uint8_t> m_Values;
+		std::span<const std::uint8_t> m_Masks;
+		std::uint32_t m_Anchor; // rarest fixed byte, used to find candidates
+		std::uint32_t m_Guard;  // second rarest fixed byte, filters candidates together with the anchor
+
+		constexpr std::size_t Size() const
+		{
+			return m_Values.size();
+		}
+	};
+
+	enum class MatcherBackend
+	{
+		SCALAR,
+		SSE2,
+		AVX2
+	};
+}
+
+namespace YimMenu::SignatureMatcher
+{
+	/**
+	 * @brief Rough relative frequency of a byte in x64 code, lower means rarer
+	 */
+	inline constexpr int ByteFrequency(std::uint8_t byte)
+	{
+		switch (byte)
+		{
+		case 0x00: return 100;
+		case 0x48: return 80;
+		case 0x8B: return 75;
+		case 0xFF: return 60;
+		case 0x89: return 55;
+		case 0xCC: return 50;
+		case 0x24: return 45;
+		case 0x8D: return 40;
+		case 0x4C: return 40;
+		case 0x0F: return 35;
+		case 0x41: return 35;
+		case 0xE8: return 35;
+		case 0x44: return 30;
+		case 0x85: return 30;
+		case 0xC0: return 30;
+		case 0x83: return 30;
+		case 0x01: return 25;
+		case 0x10: return 25;
+		case 0x20: return 25;
+		case 0x74: return 25;
+		case 0x08: return 20;
+		case 0x40: return 20;
+		case 0x49: return 20;
+		case 0x45: return 20;
+		case 0x75: return 20;
+		case 0x33: return 20;
+		case 0xC4: return 20;
+		case 0x28: return 15;
+		case 0x30: return 15;
+		case 0x5C: return 15;
+		case 0xC3: return 15;
+		case 0xC7: return 15;
+		case 0xEB: return 15;
+		case 0x80: return 15;
+		case 0x84: return 15;
+		case 0x02: return 12;
+		case 0x03: return 12;
+		case 0x04: return 12;
+		case 0x05: return 12;
+		case 0x18: return 12;
+		case 0x38: return 12;
+		case 0x50: return 12;
+		case 0x4D: return 12;
+		case 0xE9: return 12;
+		default: return 5;
+		}
+	}
+
+	/**
+	 * @brief Picks the rarest and second rarest fixed byte of a packed signature
+	 */
+	inline constexpr void SelectAnchors(std::span<const std::uint8_t> values, std::span<const std::uint8_t> masks, std::uint32_t& anchor, std::uint32_t& guard)
+	{
+		anchor = 0;
+		guard  = 0;
+
+		int anchorFrequency = INT32_MAX;
+		int guardFrequency  = INT32_MAX;
+		for (std::uint32_t i = 0; i < values.size(); i++)
+		{
+			if (!masks[i])
+				continue;
+
+			const auto frequency = ByteFrequency(values[i]);
+			if (frequency < anchorFrequency)
+			{
+				guard           = anchor;
+				guardFrequency  = anchorFrequency;
+				anchor          = i;
+				anchorFrequency = frequency;
+			}
+			else if (frequency < guardFrequency)
+			{
+				guard          = i;
+				guardFrequency = frequency;
+			}
+		}
+
+		// a single fixed byte guards itself
+		if (guardFrequency == INT32_MAX)
+			guard = anchor;
+	}
+
+	/**
+	 * @brief Fastest backend supported by the CPU we're running on
+	 */
+	MatcherBackend GetBestBackend();
+
+	/**
+	 * @brief Masked compare of a signature against data, the caller guarantees that signature.Size() bytes are readable
+	 */
+	bool Matches(const PackedSignature& signature, const std::uint8_t* data, MatcherBackend backend = GetBestBackend());
+
+	/**
+	 * @brief Finds the lowest offset at which the signature matches
+	 *
+	 * Candidates are found by comparing the anchor and guard bytes 16 (SSE2) or 32 (AVX2) positions at a time
+	 * and verified with a masked compare.
+	 */
+	std::optional<std::size_t> FindFirst(std::span<const std::uint8_t> image, const PackedSignature& signature, MatcherBackend backend = GetBestBackend());
+}
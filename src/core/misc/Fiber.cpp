@@ -0,0 +1,140 @@
+#include "Fiber.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <ucontext.h>
+#endif
+
+namespace YimMenu
+{
+	static thread_local Fiber* t_Current = nullptr;
+
+#ifdef _WIN32
+	struct Fiber::Context
+	{
+		void* m_Fiber  = nullptr;
+		void* m_Caller = nullptr;
+	};
+
+	static void* GetThreadFiber()
+	{
+		// a thread has to be a fiber itself before it can switch to one
+		if (!IsThreadAFiber())
+			return ConvertThreadToFiber(nullptr);
+		return GetCurrentFiber();
+	}
+
+	Fiber::Fiber(std::function<void()> entry, std::size_t stack_size) :
+	    m_Entry(std::move(entry)),
+	    m_Context(std::make_unique<Context>()),
+	    m_Previous(nullptr),
+	    m_Done(false)
+	{
+		m_Context->m_Fiber = CreateFiber(
+		    stack_size,
+		    [](void* param) {
+			    Run(static_cast<Fiber*>(param));
+		    },
+		    this);
+
+		if (!m_Context->m_Fiber)
+			throw std::runtime_error("CreateFiber failed");
+	}
+
+	Fiber::~Fiber()
+	{
+		DeleteFiber(m_Context->m_Fiber);
+	}
+
+	void Fiber::Resume()
+	{
+		if (m_Done)
+			return;
+
+		m_Context->m_Caller = t_Current ? t_Current->m_Context->m_Fiber : GetThreadFiber();
+		m_Previous          = t_Current;
+		t_Current           = this;
+		SwitchToFiber(m_Context->m_Fiber);
+	}
+
+	void Fiber::Suspend()
+	{
+		const auto fiber = t_Current;
+		t_Current        = fiber->m_Previous;
+		SwitchToFiber(fiber->m_Context->m_Caller);
+	}
+#else
+	struct Fiber::Context
+	{
+		static constexpr std::size_t g_DefaultStackSize = 256 * 1024;
+
+		ucontext_t m_Fiber;
+		ucontext_t m_Caller;
+		std::unique_ptr<char[]> m_Stack;
+		std::size_t m_StackSize;
+
+		// makecontext only passes int arguments, the pointer is split in two
+		static void Trampoline(unsigned int high, unsigned int low)
+		{
+			Run(reinterpret_cast<Fiber*>(static_cast<std::uintptr_t>(static_cast<std::uint64_t>(high) << 32 | low)));
+		}
+	};
+
+	Fiber::Fiber(std::function<void()> entry, std::size_t stack_size) :
+	    m_Entry(std::move(entry)),
+	    m_Context(std::make_unique<Context>()),
+	    m_Previous(nullptr),
+	    m_Done(false)
+	{
+		// nothing but this may be live across getcontext(), GCC warns that locals might be clobbered otherwise
+		m_Context->m_StackSize = stack_size ? stack_size : Context::g_DefaultStackSize;
+		m_Context->m_Stack     = std::make_unique<char[]>(m_Context->m_StackSize);
+		if (getcontext(&m_Context->m_Fiber) != 0)
+			throw std::runtime_error("getcontext failed");
+
+		m_Context->m_Fiber.uc_stack.ss_sp   = m_Context->m_Stack.get();
+		m_Context->m_Fiber.uc_stack.ss_size = m_Context->m_StackSize;
+		m_Context->m_Fiber.uc_link          = nullptr;
+
+		const auto self = reinterpret_cast<std::uintptr_t>(this);
+		makecontext(&m_Context->m_Fiber, reinterpret_cast<void (*)()>(&Context::Trampoline), 2, static_cast<unsigned int>(static_cast<std::uint64_t>(self) >> 32), static_cast<unsigned int>(self));
+	}
+
+	Fiber::~Fiber() = default;
+
+	void Fiber::Resume()
+	{
+		if (m_Done)
+			return;
+
+		m_Previous = t_Current;
+		t_Current  = this;
+		swapcontext(&m_Context->m_Caller, &m_Context->m_Fiber);
+	}
+
+	void Fiber::Suspend()
+	{
+		const auto fiber = t_Current;
+		t_Current        = fiber->m_Previous;
+		swapcontext(&fiber->m_Context->m_Fiber, &fiber->m_Context->m_Caller);
+	}
+#endif
+
+	Fiber* Fiber::Current()
+	{
+		return t_Current;
+	}
+
+	void Fiber::Run(Fiber* fiber)
+	{
+		fiber->m_Entry();
+		fiber->m_Done = true;
+
+		// returning from the entry point would end the thread, a finished fiber is never resumed again
+		Suspend();
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Cooperative execution context with its own stack, Win32 fibers on Windows and ucontext elsewhere
+	 *
+	 * A fiber runs on the thread that resumes it until it suspends itself or its entry returns, control then goes
+	 * back to where Resume() was called. Fibers may resume other fibers, the thread itself needs no preparation.
+	 */
+	class Fiber
+	{
+	public:
+		static constexpr std::size_t g_DefaultStackSize = 0; // the platform default, 1 MiB on Windows
+
+		explicit Fiber(std::function<void()> entry, std::size_t stack_size = g_DefaultStackSize);
+		~Fiber();
+
+		Fiber(const Fiber&)            = delete;
+		Fiber& operator=(const Fiber&) = delete;
+
+		/**
+		 * @brief Runs the fiber until it suspends or finishes, does nothing once it finished
+		 */
+		void Resume();
+
+		/**
+		 * @brief Switches from the running fiber back to whoever resumed it, must be called from inside a fiber
+		 */
+		static void Suspend();
+
+		/**
+		 * @brief The fiber running on this thread, nullptr outside of any fiber
+		 */
+		static Fiber* Current();
+
+		bool IsDone() const
+		{
+			return m_Done;
+		}
+
+	private:
+		struct Context; // platform state, defined in Fiber.cpp
+
+		static void Run(Fiber* fiber);
+
+		std::function<void()> m_Entry;
+		std::unique_ptr<Context> m_Context;
+		Fiber* m_Previous; // the fiber that resumed this one, nullptr for the thread
+		bool m_Done;
+	};
+}
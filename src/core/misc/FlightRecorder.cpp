@@ -0,0 +1,130 @@
+#include "FlightRecorder.hpp"
+
+#include <cstdio>
+#include <functional>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+#if defined(_M_X64) || defined(__x86_64__)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define FLIGHT_RECORDER_TSC
+#endif
+
+namespace YimMenu
+{
+	static std::uint64_t Now()
+	{
+#ifdef FLIGHT_RECORDER_TSC
+		return __rdtsc();
+#else
+		return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+	}
+
+	static std::uint32_t CurrentThreadId()
+	{
+		// the OS id so that records can be matched with the thread in the stack trace
+#ifdef _WIN32
+		thread_local const auto id = static_cast<std::uint32_t>(GetCurrentThreadId());
+#else
+		thread_local const auto id = static_cast<std::uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+		return id;
+	}
+
+	FlightRecorder::FlightRecorder() :
+	    m_Head(0),
+	    m_Slots(),
+	    m_StartTicks(Now()),
+	    m_StartSteady(std::chrono::steady_clock::now()),
+	    m_StartTime(std::chrono::system_clock::now())
+	{
+	}
+
+	void FlightRecorder::SetDumpFile(const std::filesystem::path& file)
+	{
+		GetInstance().m_DumpFile = file;
+	}
+
+	void FlightRecorder::Record(FlightEvent event, std::uint64_t arg0, std::uint64_t arg1, std::uint64_t arg2)
+	{
+		GetInstance().RecordImpl(event, arg0, arg1, arg2);
+	}
+
+	bool FlightRecorder::Dump()
+	{
+		auto& instance = GetInstance();
+		return !instance.m_DumpFile.empty() && instance.DumpImpl(instance.m_DumpFile);
+	}
+
+	bool FlightRecorder::Dump(const std::filesystem::path& file)
+	{
+		return GetInstance().DumpImpl(file);
+	}
+
+	void FlightRecorder::RecordImpl(FlightEvent event, std::uint64_t arg0, std::uint64_t arg1, std::uint64_t arg2)
+	{
+		const auto index = m_Head.fetch_add(1, std::memory_order_relaxed);
+		auto& slot       = m_Slots[index & (g_Capacity - 1)];
+
+		// per slot seqlock like the Tracer, a writer lapping the ring or a concurrent dump only ever loses the record
+		slot.m_Sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		slot.m_Entry = {Now(), CurrentThreadId(), event, {arg0, arg1, arg2}};
+		slot.m_Sequence.store(index + 1, std::memory_order_release);
+	}
+
+	bool FlightRecorder::DumpImpl(const std::filesystem::path& file)
+	{
+		// we are most likely running inside the exception handler, so stick to the C runtime and the stack
+#ifdef _WIN32
+		const auto stream = _wfopen(file.c_str(), L"wb");
+#else
+		const auto stream = std::fopen(file.c_str(), "wb");
+#endif
+		if (!stream)
+			return false;
+
+		const auto ticks   = Now() - m_StartTicks;
+		const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartSteady).count();
+
+		DumpHeader header{DumpHeader::Magic, DumpHeader::Version, sizeof(Entry), 0, m_StartTicks, std::chrono::duration_cast<std::chrono::nanoseconds>(m_StartTime.time_since_epoch()).count(), elapsed > 0 && ticks ? ticks / elapsed : 1e9};
+		bool ok = std::fwrite(&header, sizeof(header), 1, stream) == 1;
+
+		std::array<Entry, 64> batch;
+		std::size_t batchSize = 0;
+		const auto flush      = [&] {
+			ok &= std::fwrite(batch.data(), sizeof(Entry), batchSize, stream) == batchSize;
+			header.m_Count += static_cast<std::uint32_t>(batchSize);
+			batchSize = 0;
+		};
+
+		const auto head = m_Head.load(std::memory_order_acquire);
+		for (auto index = head > g_Capacity ? head - g_Capacity : 0; index < head; index++)
+		{
+			auto& slot = m_Slots[index & (g_Capacity - 1)];
+			if (slot.m_Sequence.load(std::memory_order_acquire) != index + 1)
+				continue;
+
+			batch[batchSize] = slot.m_Entry;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (slot.m_Sequence.load(std::memory_order_relaxed) != index + 1)
+				continue;
+
+			if (++batchSize == batch.size())
+				flush();
+		}
+		flush();
+
+		ok &= std::fseek(stream, 0, SEEK_SET) == 0 && std::fwrite(&header, sizeof(header), 1, stream) == 1;
+		ok &= std::fclose(stream) == 0;
+		return ok;
+	}
+}
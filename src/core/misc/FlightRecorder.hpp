@@ -0,0 +1,123 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+namespace YimMenu
+{
+	enum class FlightEvent : std::uint32_t
+	{
+		FRAME,       // frame
+		FIBER_JOB,   // file name hash, line
+		COMMAND,     // command hash
+		NET_MESSAGE, // message type, length, message id
+		NET_EVENT,   // event type, source player, target player (g_FlightNoPlayer if there is none)
+		CLONE_SYNC,  // object type, object id, source player (g_FlightNoPlayer if there is none)
+		EXCEPTION,   // exception code, address, trace hash
+		COUNT
+	};
+
+	// recorded in place of a player index for events without a player, like the "unknown player" of SyncNodeDumper
+	inline constexpr std::uint64_t g_FlightNoPlayer = 0xFF;
+
+	struct FlightEventInfo
+	{
+		struct Arg
+		{
+			const char* m_Name; // nullptr for unused arguments
+			bool m_Hex;
+		};
+
+		const char* m_Name;
+		std::array<Arg, 3> m_Args;
+	};
+
+	// shared with tools/FlightDecode.cpp, append new events at the end to keep old dumps readable
+	inline constexpr std::array<FlightEventInfo, static_cast<std::size_t>(FlightEvent::COUNT)> g_FlightEventInfo{{
+	    {"FRAME", {{{"frame", false}}}},
+	    {"FIBER_JOB", {{{"file", true}, {"line", false}}}},
+	    {"COMMAND", {{{"hash", true}}}},
+	    {"NET_MESSAGE", {{{"type", false}, {"length", false}, {"msgId", false}}}},
+	    {"NET_EVENT", {{{"type", false}, {"source", false}, {"target", false}}}},
+	    {"CLONE_SYNC", {{{"objectType", false}, {"objectId", false}, {"source", false}}}},
+	    {"EXCEPTION", {{{"code", true}, {"address", true}, {"trace", true}}}},
+	}};
+
+	/**
+	 * @brief Always-on ring buffer of the most recent binary events, written to disk when we crash
+	 *
+	 * Every thread appends to the same fixed-size ring, so recording is a single atomic increment and a 40 byte
+	 * store without any allocation or lock. Unlike the log this survives until the exception handler runs,
+	 * which makes it the only record of what led up to a crash. Decode dumps with TerminusFlightDecode.
+	 */
+	class FlightRecorder
+	{
+	public:
+		static constexpr std::size_t g_Capacity = 1 << 14; // must be a power of two
+
+		struct Entry
+		{
+			std::uint64_t m_Timestamp; // TSC ticks, calibrated by the dump header
+			std::uint32_t m_Thread;
+			FlightEvent m_Event;
+			std::array<std::uint64_t, 3> m_Args;
+		};
+
+		struct DumpHeader
+		{
+			static constexpr std::uint32_t Magic   = 0x31524654; // TFR1
+			static constexpr std::uint32_t Version = 1;
+
+			std::uint32_t m_Magic;
+			std::uint32_t m_Version;
+			std::uint32_t m_RecordSize;
+			std::uint32_t m_Count; // records following the header, oldest first
+			std::uint64_t m_StartTicks;
+			std::int64_t m_StartTime; // system clock at m_StartTicks, nanoseconds since the epoch
+			double m_TicksPerSecond;
+		};
+
+		/**
+		 * @brief Sets the file written by Dump(), call once during startup
+		 */
+		static void SetDumpFile(const std::filesystem::path& file);
+
+		static void Record(FlightEvent event, std::uint64_t arg0 = 0, std::uint64_t arg1 = 0, std::uint64_t arg2 = 0);
+
+		/**
+		 * @brief Writes the contents of the ring to the dump file
+		 *
+		 * Safe to call from the exception handler: it does not allocate or take locks, and records that are
+		 * overwritten while dumping are skipped instead of written torn.
+		 */
+		static bool Dump();
+		static bool Dump(const std::filesystem::path& file);
+
+	private:
+		struct Slot
+		{
+			std::atomic<std::uint64_t> m_Sequence; // index + 1 of the record in the slot, 0 while it is being written
+			Entry m_Entry;
+		};
+
+		FlightRecorder();
+
+		void RecordImpl(FlightEvent event, std::uint64_t arg0, std::uint64_t arg1, std::uint64_t arg2);
+		bool DumpImpl(const std::filesystem::path& file);
+
+		static FlightRecorder& GetInstance()
+		{
+			static FlightRecorder i{};
+			return i;
+		}
+
+		std::atomic<std::uint64_t> m_Head; // amount of records ever written
+		std::array<Slot, g_Capacity> m_Slots;
+		std::uint64_t m_StartTicks;
+		std::chrono::steady_clock::time_point m_StartSteady;
+		std::chrono::system_clock::time_point m_StartTime;
+		std::filesystem::path m_DumpFile;
+	};
+}
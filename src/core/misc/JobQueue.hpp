@@ -0,0 +1,221 @@
+#pragma once
+#include "MpmcQueue.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <mutex>
+
+namespace YimMenu
+{
+	enum class JobPriority : std::uint8_t
+	{
+		INTERACTIVE, // a user is waiting on the result, clicks and hotkeys
+		BACKGROUND,
+		COUNT
+	};
+
+	struct JobQueueStats
+	{
+		std::array<std::uint32_t, static_cast<std::size_t>(JobPriority::COUNT)> m_Depth; // jobs waiting right now
+		std::uint32_t m_MaxDepth;
+		std::uint64_t m_Pushed;
+		std::uint64_t m_Run;
+		std::uint64_t m_Overflowed; // pushes that found the ring full
+		double m_AverageWaitMs;     // from the push until the job starts
+		double m_MaxWaitMs;
+	};
+
+	/**
+	 * @brief FIFO of jobs in two priorities, drained within a time budget per tick
+	 *
+	 * Jobs go into a lock-free ring per priority. A full ring spills into a locked overflow list that is used until
+	 * it is empty again, which keeps the order but never blocks or drops a push. Interactive jobs are taken first,
+	 * except for every g_BackgroundInterval'th job so that background work can't be starved.
+	 */
+	template<typename Job>
+	class JobQueue
+	{
+	public:
+		static constexpr std::size_t g_BackgroundInterval = 8;
+
+		explicit JobQueue(std::size_t capacity, std::chrono::nanoseconds budget) :
+		    m_Lanes{Lane(capacity), Lane(capacity)},
+		    m_Budget(budget.count())
+		{
+		}
+
+		void Push(Job&& job, JobPriority priority)
+		{
+			auto& lane = m_Lanes[static_cast<std::size_t>(priority)];
+			Entry entry{std::move(job), Now()};
+
+			// counted before it can be popped, so the depth never goes negative
+			const auto depth = static_cast<std::uint32_t>(lane.m_Pushed.fetch_add(1, std::memory_order_relaxed) + 1 - lane.m_Popped.load(std::memory_order_relaxed));
+			auto max         = m_MaxDepth.load(std::memory_order_relaxed);
+			while (depth > max && !m_MaxDepth.compare_exchange_weak(max, depth, std::memory_order_relaxed))
+				;
+
+			if (lane.m_OverflowSize.load(std::memory_order_acquire) || !lane.m_Ring.TryPush(std::move(entry)))
+			{
+				std::lock_guard lock(lane.m_OverflowMutex);
+				lane.m_Overflow.push_back(std::move(entry));
+				lane.m_OverflowSize.fetch_add(1, std::memory_order_release);
+				m_Overflowed.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		bool TryPop(Job& job)
+		{
+			const auto background = m_Taken.fetch_add(1, std::memory_order_relaxed) % g_BackgroundInterval == g_BackgroundInterval - 1;
+			const auto first      = background ? JobPriority::BACKGROUND : JobPriority::INTERACTIVE;
+			const auto second     = background ? JobPriority::INTERACTIVE : JobPriority::BACKGROUND;
+
+			Entry entry;
+			if (!TryPop(m_Lanes[static_cast<std::size_t>(first)], entry) && !TryPop(m_Lanes[static_cast<std::size_t>(second)], entry))
+				return false;
+
+			const auto wait = static_cast<std::uint64_t>(std::max<std::int64_t>(Now() - entry.m_Pushed, 0));
+			m_WaitTotal.fetch_add(wait, std::memory_order_relaxed);
+			auto max = m_MaxWait.load(std::memory_order_relaxed);
+			while (wait > max && !m_MaxWait.compare_exchange_weak(max, wait, std::memory_order_relaxed))
+				;
+
+			job = std::move(entry.m_Job);
+			return true;
+		}
+
+		/**
+		 * @brief Runs jobs until the budget of this tick is used up, every caller in the same tick shares it
+		 *
+		 * At least one job runs per call no matter the budget. A job may yield to later ticks, the time it spent
+		 * waiting is then charged to the tick it started in, which is already over.
+		 */
+		template<typename F>
+		std::size_t Drain(std::uint64_t tick, F&& run)
+		{
+			if (m_Tick.exchange(tick, std::memory_order_relaxed) != tick)
+				m_Used.store(0, std::memory_order_relaxed);
+
+			std::size_t count = 0;
+			do
+			{
+				Job job;
+				if (!TryPop(job))
+					break;
+
+				const auto start = Now();
+				run(job);
+				count++;
+				m_Run.fetch_add(1, std::memory_order_relaxed);
+
+				if (m_Tick.load(std::memory_order_relaxed) != tick)
+					break;
+				m_Used.fetch_add(Now() - start, std::memory_order_relaxed);
+			} while (m_Used.load(std::memory_order_relaxed) < m_Budget.load(std::memory_order_relaxed));
+
+			return count;
+		}
+
+		void SetBudget(std::chrono::nanoseconds budget)
+		{
+			m_Budget = budget.count();
+		}
+
+		void Clear()
+		{
+			Job job;
+			while (TryPop(job))
+				;
+		}
+
+		JobQueueStats GetStats() const
+		{
+			JobQueueStats stats{};
+			for (std::size_t i = 0; i < m_Lanes.size(); i++)
+			{
+				const auto pushed = m_Lanes[i].m_Pushed.load(std::memory_order_relaxed);
+				const auto popped = m_Lanes[i].m_Popped.load(std::memory_order_relaxed);
+				stats.m_Depth[i]  = static_cast<std::uint32_t>(pushed > popped ? pushed - popped : 0);
+				stats.m_Pushed += pushed;
+			}
+
+			const auto popped     = m_Lanes[0].m_Popped.load(std::memory_order_relaxed) + m_Lanes[1].m_Popped.load(std::memory_order_relaxed);
+			stats.m_MaxDepth      = m_MaxDepth.load(std::memory_order_relaxed);
+			stats.m_Run           = m_Run.load(std::memory_order_relaxed);
+			stats.m_Overflowed    = m_Overflowed.load(std::memory_order_relaxed);
+			stats.m_AverageWaitMs = popped ? m_WaitTotal.load(std::memory_order_relaxed) / 1e6 / popped : 0.0;
+			stats.m_MaxWaitMs     = m_MaxWait.load(std::memory_order_relaxed) / 1e6;
+			return stats;
+		}
+
+		/**
+		 * @brief Resets the peaks, the totals keep counting
+		 */
+		void ResetPeaks()
+		{
+			m_MaxDepth = 0;
+			m_MaxWait  = 0;
+		}
+
+	private:
+		struct Entry
+		{
+			Job m_Job;
+			std::int64_t m_Pushed;
+		};
+
+		struct Lane
+		{
+			explicit Lane(std::size_t capacity) :
+			    m_Ring(capacity)
+			{
+			}
+
+			MpmcQueue<Entry> m_Ring;
+			std::mutex m_OverflowMutex;
+			std::deque<Entry> m_Overflow;
+			std::atomic<std::size_t> m_OverflowSize = 0;
+			std::atomic<std::uint64_t> m_Pushed     = 0;
+			std::atomic<std::uint64_t> m_Popped     = 0;
+		};
+
+		static std::int64_t Now()
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		static bool TryPop(Lane& lane, Entry& entry)
+		{
+			// the overflow only holds jobs pushed after everything in the ring, so it goes second
+			if (!lane.m_Ring.TryPop(entry))
+			{
+				if (!lane.m_OverflowSize.load(std::memory_order_acquire))
+					return false;
+
+				std::lock_guard lock(lane.m_OverflowMutex);
+				if (lane.m_Overflow.empty())
+					return false;
+
+				entry = std::move(lane.m_Overflow.front());
+				lane.m_Overflow.pop_front();
+				lane.m_OverflowSize.fetch_sub(1, std::memory_order_release);
+			}
+
+			lane.m_Popped.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		std::array<Lane, static_cast<std::size_t>(JobPriority::COUNT)> m_Lanes;
+		std::atomic<std::int64_t> m_Budget;
+		std::atomic<std::uint64_t> m_Tick = 0;
+		std::atomic<std::int64_t> m_Used  = 0;
+		std::atomic<std::uint64_t> m_Taken = 0;
+		std::atomic<std::uint64_t> m_Run   = 0;
+		std::atomic<std::uint64_t> m_Overflowed = 0;
+		std::atomic<std::uint32_t> m_MaxDepth   = 0;
+		std::atomic<std::uint64_t> m_WaitTotal  = 0;
+		std::atomic<std::uint64_t> m_MaxWait    = 0;
+	};
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Bounded lock-free multi producer multi consumer FIFO
+	 *
+	 * Every cell carries a sequence number that tells producers and consumers whose turn it is, so neither side ever
+	 * waits on the other. A full queue fails TryPush instead of blocking, the capacity is rounded up to a power of two.
+	 */
+	template<typename T>
+	class MpmcQueue
+	{
+	public:
+		explicit MpmcQueue(std::size_t capacity) :
+		    m_Mask(std::bit_ceil(capacity < 2 ? 2 : capacity) - 1),
+		    m_Cells(std::make_unique<Cell[]>(m_Mask + 1)),
+		    m_Tail(0),
+		    m_Head(0)
+		{
+			for (std::size_t i = 0; i <= m_Mask; i++)
+				m_Cells[i].m_Sequence.store(i, std::memory_order_relaxed);
+		}
+
+		MpmcQueue(const MpmcQueue&)            = delete;
+		MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+		bool TryPush(T&& value)
+		{
+			auto position = m_Tail.load(std::memory_order_relaxed);
+			Cell* cell;
+			while (true)
+			{
+				cell            = &m_Cells[position & m_Mask];
+				const auto diff = static_cast<std::intptr_t>(cell->m_Sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(position);
+				if (diff == 0)
+				{
+					if (m_Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+					return false; // the consumer of the previous lap has not freed the cell yet
+				else
+					position = m_Tail.load(std::memory_order_relaxed);
+			}
+
+			cell->m_Value = std::move(value);
+			cell->m_Sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool TryPop(T& value)
+		{
+			auto position = m_Head.load(std::memory_order_relaxed);
+			Cell* cell;
+			while (true)
+			{
+				cell            = &m_Cells[position & m_Mask];
+				const auto diff = static_cast<std::intptr_t>(cell->m_Sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(position + 1);
+				if (diff == 0)
+				{
+					if (m_Head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+					return false;
+				else
+					position = m_Head.load(std::memory_order_relaxed);
+			}
+
+			value         = std::move(cell->m_Value);
+			cell->m_Value = T{}; // don't keep whatever the value owns alive until the cell is reused
+			cell->m_Sequence.store(position + m_Mask + 1, std::memory_order_release);
+			return true;
+		}
+
+		std::size_t Capacity() const
+		{
+			return m_Mask + 1;
+		}
+
+	private:
+		struct Cell
+		{
+			std::atomic<std::size_t> m_Sequence;
+			T m_Value;
+		};
+
+		const std::size_t m_Mask;
+		const std::unique_ptr<Cell[]> m_Cells;
+		alignas(64) std::atomic<std::size_t> m_Tail;
+		alignas(64) std::atomic<std::size_t> m_Head;
+	};
+}
@@ -0,0 +1,44 @@
+#include "StartupTimer.hpp"
+
+#include <algorithm>
+
+namespace YimMenu
+{
+	static double ToMilliseconds(std::chrono::steady_clock::duration duration)
+	{
+		return std::chrono::duration<double, std::milli>(duration).count();
+	}
+
+	void StartupTimer::StartImpl()
+	{
+		std::lock_guard lock(m_Mutex);
+		m_Start = Clock::now();
+		m_Phases.clear();
+	}
+
+	void StartupTimer::MarkImpl(std::string_view phase)
+	{
+		const auto elapsed = Clock::now() - m_Start;
+
+		std::lock_guard lock(m_Mutex);
+		m_Phases.emplace_back(phase, elapsed);
+		LOG(VERBOSE) << "[Startup] " << phase << " after " << ToMilliseconds(elapsed) << " ms";
+	}
+
+	void StartupTimer::FirstFrameImpl()
+	{
+		const auto elapsed = Clock::now() - m_Start;
+
+		std::lock_guard lock(m_Mutex);
+		// phases can finish on other threads, list them in the order they ended
+		std::ranges::sort(m_Phases, {}, &decltype(m_Phases)::value_type::second);
+
+		LOG(INFO) << "Time from injection to first frame: " << ToMilliseconds(elapsed) << " ms";
+		auto previous = Clock::duration::zero();
+		for (const auto& [phase, end] : m_Phases)
+		{
+			LOG(INFO) << "  " << phase << ": " << ToMilliseconds(end - previous) << " ms (at " << ToMilliseconds(end) << " ms)";
+			previous = end;
+		}
+	}
+}
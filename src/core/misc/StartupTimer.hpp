@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Measures the time from injection to the first frame the menu draws, split into named phases
+	 */
+	class StartupTimer
+	{
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		Clock::time_point m_Start;
+		std::vector<std::pair<std::string, Clock::duration>> m_Phases;
+		std::mutex m_Mutex;
+		std::atomic<bool> m_FirstFrame;
+
+	public:
+		/**
+		 * @brief Call as early as possible, everything else is measured relative to it
+		 */
+		static void Start()
+		{
+			GetInstance().StartImpl();
+		}
+
+		/**
+		 * @brief Records the end of a startup phase, safe to call from any thread
+		 */
+		static void Mark(std::string_view phase)
+		{
+			GetInstance().MarkImpl(phase);
+		}
+
+		/**
+		 * @brief Called every frame by the renderer, logs the summary the first time
+		 */
+		static void FirstFrame()
+		{
+			if (!GetInstance().m_FirstFrame.exchange(true, std::memory_order_relaxed))
+				GetInstance().FirstFrameImpl();
+		}
+
+	private:
+		StartupTimer() :
+		    m_Start(Clock::now()),
+		    m_FirstFrame(false)
+		{
+		}
+
+		void StartImpl();
+		void MarkImpl(std::string_view phase);
+		void FirstFrameImpl();
+
+		static StartupTimer& GetInstance()
+		{
+			static StartupTimer i{};
+			return i;
+		}
+	};
+}
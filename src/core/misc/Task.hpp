@@ -0,0 +1,369 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace YimMenu
+{
+	template<typename T = void>
+	class Task;
+
+	namespace Detail
+	{
+		struct FinalAwaiter
+		{
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			// hands control straight to whoever awaited the task, a root task returns to the scheduler
+			template<typename Promise>
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+			{
+				if (auto continuation = handle.promise().m_Continuation)
+					return continuation;
+				return std::noop_coroutine();
+			}
+
+			void await_resume() const noexcept
+			{
+			}
+		};
+
+		struct PromiseBase
+		{
+			std::coroutine_handle<> m_Continuation;
+			std::exception_ptr m_Exception;
+
+			std::suspend_always initial_suspend() const noexcept
+			{
+				return {};
+			}
+
+			FinalAwaiter final_suspend() const noexcept
+			{
+				return {};
+			}
+
+			void unhandled_exception() noexcept
+			{
+				m_Exception = std::current_exception();
+			}
+		};
+
+		template<typename T>
+		struct Promise : PromiseBase
+		{
+			std::optional<T> m_Value;
+
+			template<typename U>
+			void return_value(U&& value)
+			{
+				m_Value.emplace(std::forward<U>(value));
+			}
+
+			T GetResult()
+			{
+				if (m_Exception)
+					std::rethrow_exception(m_Exception);
+				return std::move(*m_Value);
+			}
+		};
+
+		template<>
+		struct Promise<void> : PromiseBase
+		{
+			void return_void() const noexcept
+			{
+			}
+
+			void GetResult() const
+			{
+				if (m_Exception)
+					std::rethrow_exception(m_Exception);
+			}
+		};
+	}
+
+	/**
+	 * @brief Lazily started coroutine for game thread work, returns a T to whoever co_awaits it
+	 *
+	 * A task does nothing until it is awaited by another task or handed to ScriptMgr::Spawn(), and its frame lives as
+	 * long as the Task object does. Exceptions are stored and rethrown to the awaiting task. Coroutine parameters are
+	 * copied into the frame but lambda captures are not, so write tasks as functions that take their state by value.
+	 */
+	template<typename T>
+	class [[nodiscard]] Task
+	{
+	public:
+		struct promise_type : Detail::Promise<T>
+		{
+			Task get_return_object() noexcept
+			{
+				return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+			}
+		};
+
+		using Handle = std::coroutine_handle<promise_type>;
+
+		Task() = default;
+
+		explicit Task(Handle handle) :
+		    m_Handle(handle)
+		{
+		}
+
+		Task(Task&& other) noexcept :
+		    m_Handle(std::exchange(other.m_Handle, nullptr))
+		{
+		}
+
+		Task& operator=(Task&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (m_Handle)
+					m_Handle.destroy();
+				m_Handle = std::exchange(other.m_Handle, nullptr);
+			}
+			return *this;
+		}
+
+		Task(const Task&)            = delete;
+		Task& operator=(const Task&) = delete;
+
+		~Task()
+		{
+			if (m_Handle)
+				m_Handle.destroy();
+		}
+
+		bool IsDone() const
+		{
+			return !m_Handle || m_Handle.done();
+		}
+
+		/**
+		 * @brief Result of a finished task, rethrows the exception it ended with
+		 */
+		T Get()
+		{
+			return m_Handle.promise().GetResult();
+		}
+
+		Handle GetHandle() const
+		{
+			return m_Handle;
+		}
+
+		auto operator co_await() noexcept
+		{
+			return Awaiter<true>{m_Handle};
+		}
+
+		/**
+		 * @brief Waits for the task to finish without taking its result or exception, Get() them afterwards
+		 */
+		auto WhenReady() noexcept
+		{
+			return Awaiter<false>{m_Handle};
+		}
+
+	private:
+		template<bool TakeResult>
+		struct Awaiter
+		{
+			Handle m_Handle;
+
+			bool await_ready() const noexcept
+			{
+				return !m_Handle || m_Handle.done();
+			}
+
+			// starts the task on this thread, it comes back here through its final suspend
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept
+			{
+				m_Handle.promise().m_Continuation = awaiting;
+				return m_Handle;
+			}
+
+			decltype(auto) await_resume() const
+			{
+				if constexpr (TakeResult)
+					return m_Handle.promise().GetResult();
+			}
+		};
+
+		Handle m_Handle = nullptr;
+	};
+
+	namespace Detail
+	{
+		struct WhenAllLatch
+		{
+			std::size_t m_Remaining = 0;
+			std::coroutine_handle<> m_Waiter;
+		};
+
+		// tracks one task of a WhenAll(), the last one to finish resumes the waiter
+		class WhenAllWatcher
+		{
+		public:
+			struct promise_type
+			{
+				WhenAllLatch* m_Latch = nullptr;
+
+				WhenAllWatcher get_return_object() noexcept
+				{
+					return WhenAllWatcher(std::coroutine_handle<promise_type>::from_promise(*this));
+				}
+
+				std::suspend_always initial_suspend() const noexcept
+				{
+					return {};
+				}
+
+				auto final_suspend() const noexcept
+				{
+					struct Awaiter
+					{
+						bool await_ready() const noexcept
+						{
+							return false;
+						}
+
+						std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+						{
+							auto& latch = *handle.promise().m_Latch;
+							if (--latch.m_Remaining == 0)
+								return latch.m_Waiter;
+							return std::noop_coroutine();
+						}
+
+						void await_resume() const noexcept
+						{
+						}
+					};
+					return Awaiter{};
+				}
+
+				void return_void() const noexcept
+				{
+				}
+
+				void unhandled_exception() const noexcept
+				{
+					std::terminate(); // WhenReady() does not throw
+				}
+			};
+
+			explicit WhenAllWatcher(std::coroutine_handle<promise_type> handle) :
+			    m_Handle(handle)
+			{
+			}
+
+			WhenAllWatcher(WhenAllWatcher&& other) noexcept :
+			    m_Handle(std::exchange(other.m_Handle, nullptr))
+			{
+			}
+
+			~WhenAllWatcher()
+			{
+				if (m_Handle)
+					m_Handle.destroy();
+			}
+
+			void Start(WhenAllLatch& latch)
+			{
+				m_Handle.promise().m_Latch = &latch;
+				m_Handle.resume();
+			}
+
+		private:
+			std::coroutine_handle<promise_type> m_Handle;
+		};
+
+		template<typename T>
+		WhenAllWatcher Watch(Task<T>& task)
+		{
+			co_await task.WhenReady();
+		}
+
+		template<typename T>
+		struct WhenAllAwaiter
+		{
+			std::vector<Task<T>>& m_Tasks;
+			std::vector<WhenAllWatcher> m_Watchers;
+			WhenAllLatch m_Latch;
+
+			explicit WhenAllAwaiter(std::vector<Task<T>>& tasks) :
+			    m_Tasks(tasks)
+			{
+			}
+
+			bool await_ready() const noexcept
+			{
+				return m_Tasks.empty();
+			}
+
+			bool await_suspend(std::coroutine_handle<> waiter)
+			{
+				// one extra count so tasks that finish right away cannot resume the waiter before it suspended
+				m_Latch.m_Remaining = m_Tasks.size() + 1;
+				m_Latch.m_Waiter    = waiter;
+
+				m_Watchers.reserve(m_Tasks.size());
+				for (auto& task : m_Tasks)
+					m_Watchers.push_back(Watch(task));
+				for (auto& watcher : m_Watchers)
+					watcher.Start(m_Latch);
+
+				return --m_Latch.m_Remaining != 0;
+			}
+
+			void await_resume() const noexcept
+			{
+			}
+		};
+	}
+
+	/**
+	 * @brief Runs all tasks at the same time and finishes once every one of them did, results keep the order of the tasks
+	 *
+	 * If tasks threw, the exception of the first one in order is rethrown after all of them finished.
+	 */
+	template<typename T>
+	Task<std::conditional_t<std::is_void_v<T>, void, std::vector<T>>> WhenAll(std::vector<Task<T>> tasks)
+	{
+		co_await Detail::WhenAllAwaiter<T>(tasks);
+
+		if constexpr (std::is_void_v<T>)
+		{
+			for (auto& task : tasks)
+				task.Get();
+		}
+		else
+		{
+			std::vector<T> results;
+			results.reserve(tasks.size());
+			for (auto& task : tasks)
+				results.push_back(task.Get());
+			co_return results;
+		}
+	}
+
+	template<typename... Tasks>
+	    requires(std::is_same_v<std::remove_cvref_t<Tasks>, Task<>> && ...)
+	Task<> WhenAll(Tasks&&... tasks)
+	{
+		std::vector<Task<>> all;
+		all.reserve(sizeof...(Tasks));
+		(all.push_back(std::move(tasks)), ...);
+		return WhenAll(std::move(all));
+	}
+}
@@ -0,0 +1,149 @@
+#pragma once
+#include "Task.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Runs Task coroutines once per tick, the coroutine counterpart of the script fibers
+	 *
+	 * A suspended task costs its frame and a queue entry, not a stack. Tasks come back on the next tick or, if they
+	 * sleep, once their wake time is due. Only Spawn() may be called from other threads, everything else belongs to
+	 * the thread that calls Tick().
+	 */
+	template<typename Clock = std::chrono::steady_clock>
+	class TaskScheduler
+	{
+	public:
+		using TimePoint = typename Clock::time_point;
+
+		/**
+		 * @brief Takes ownership of a task, it starts on the next tick and is freed once it finished
+		 */
+		void Spawn(Task<> task)
+		{
+			std::lock_guard lock(m_SpawnMutex);
+			m_Spawned.push_back(std::move(task));
+		}
+
+		/**
+		 * @brief Resumes a suspended coroutine on the next tick, or the first tick at or after wake_time
+		 */
+		void Schedule(std::coroutine_handle<> handle, std::optional<TimePoint> wake_time = std::nullopt)
+		{
+			if (!wake_time)
+			{
+				m_Ready.push_back(handle);
+				return;
+			}
+
+			m_Sleeping.push_back({*wake_time, m_NextOrder++, handle});
+			std::ranges::push_heap(m_Sleeping, std::greater{});
+		}
+
+		/**
+		 * @brief Resumes every coroutine that is due, then frees the finished tasks
+		 *
+		 * A task that ended with an exception is freed like any other and its exception handed to on_error, nothing
+		 * is thrown out of here since the caller usually runs inside a game hook.
+		 */
+		template<typename OnError>
+		void Tick(TimePoint now, OnError&& on_error)
+		{
+			{
+				std::lock_guard lock(m_SpawnMutex);
+				for (auto& task : m_Spawned)
+				{
+					m_Ready.push_back(task.GetHandle());
+					m_Tasks.push_back(std::move(task));
+				}
+				m_Spawned.clear();
+			}
+
+			while (!m_Sleeping.empty() && m_Sleeping.front().m_WakeTime <= now)
+			{
+				std::ranges::pop_heap(m_Sleeping, std::greater{});
+				m_Ready.push_back(m_Sleeping.back().m_Handle);
+				m_Sleeping.pop_back();
+			}
+
+			// whatever schedules itself while running goes into the fresh list and waits for the next tick
+			std::swap(m_Ready, m_Running);
+			for (const auto handle : m_Running)
+				handle.resume();
+			m_Running.clear();
+
+			std::erase_if(m_Tasks, [&on_error](Task<>& task) {
+				if (!task.IsDone())
+					return false;
+
+				try
+				{
+					task.Get();
+				}
+				catch (...)
+				{
+					on_error(std::current_exception());
+				}
+				return true;
+			});
+		}
+
+		/**
+		 * @brief Frees all tasks without resuming them again
+		 */
+		void Clear()
+		{
+			m_Ready.clear();
+			m_Sleeping.clear();
+			m_Tasks.clear();
+
+			std::lock_guard lock(m_SpawnMutex);
+			m_Spawned.clear();
+		}
+
+		/**
+		 * @brief Number of tasks that were spawned and did not finish yet
+		 */
+		std::size_t GetTaskCount() const
+		{
+			return m_Tasks.size();
+		}
+
+		std::size_t GetSleepingCount() const
+		{
+			return m_Sleeping.size();
+		}
+
+	private:
+		struct Sleeper
+		{
+			TimePoint m_WakeTime;
+			std::uint64_t m_Order; // coroutines due at the same time run in the order they went to sleep
+			std::coroutine_handle<> m_Handle;
+
+			bool operator>(const Sleeper& other) const
+			{
+				if (m_WakeTime != other.m_WakeTime)
+					return m_WakeTime > other.m_WakeTime;
+				return m_Order > other.m_Order;
+			}
+		};
+
+		std::mutex m_SpawnMutex;
+		std::vector<Task<>> m_Spawned;
+		std::vector<Task<>> m_Tasks;
+		std::vector<std::coroutine_handle<>> m_Ready;
+		std::vector<std::coroutine_handle<>> m_Running;
+		std::vector<Sleeper> m_Sleeping; // min-heap on the wake time
+		std::uint64_t m_NextOrder = 0;
+	};
+}
@@ -0,0 +1,135 @@
+#include "TickProfiler.hpp"
+#include "util/JsonEscape.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+
+namespace YimMenu
+{
+	static constexpr int g_SubBuckets = 4;
+
+	// the two bits below the most significant one pick the sub bucket, so every bucket spans at most 25%
+	static std::size_t GetBucket(std::uint64_t ns, std::size_t count)
+	{
+		if (ns < g_SubBuckets)
+			return ns;
+
+		const auto exponent = std::bit_width(ns) - 1;
+		const auto mantissa = (ns >> (exponent - 2)) & (g_SubBuckets - 1);
+		return std::min<std::size_t>((exponent - 1) * g_SubBuckets + mantissa, count - 1);
+	}
+
+	static std::uint64_t GetBucketUpperBound(std::size_t bucket)
+	{
+		if (bucket < g_SubBuckets)
+			return bucket;
+
+		const auto exponent = bucket / g_SubBuckets + 1;
+		const auto mantissa = bucket % g_SubBuckets;
+		return ((g_SubBuckets + mantissa + 1) << (exponent - 2)) - 1;
+	}
+
+	void TickProfiler::Entry::Record(std::chrono::nanoseconds duration)
+	{
+		const auto ns = static_cast<std::uint64_t>(std::max<std::int64_t>(duration.count(), 0));
+
+		m_Calls.fetch_add(1, std::memory_order_relaxed);
+		m_TotalNs.fetch_add(ns, std::memory_order_relaxed);
+		m_Histogram[GetBucket(ns, m_Histogram.size())].fetch_add(1, std::memory_order_relaxed);
+
+		auto max = m_MaxNs.load(std::memory_order_relaxed);
+		while (ns > max && !m_MaxNs.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+			;
+	}
+
+	TickProfiler::Entry* TickProfiler::GetEntryImpl(std::string_view name, std::string_view category)
+	{
+		std::lock_guard lock(m_Mutex);
+
+		auto key = std::string(category).append(1, '/').append(name);
+		if (auto it = m_EntriesByName.find(key); it != m_EntriesByName.end())
+			return it->second;
+
+		auto entry = &m_Entries.emplace_back(std::string(name), category);
+		m_EntriesByName.emplace(std::move(key), entry);
+		return entry;
+	}
+
+	std::vector<TickProfiler::Stats> TickProfiler::GetStatsImpl()
+	{
+		std::lock_guard lock(m_Mutex);
+
+		std::vector<Stats> stats;
+		for (auto& entry : m_Entries)
+		{
+			const auto calls = entry.m_Calls.load(std::memory_order_relaxed);
+			if (!calls)
+				continue;
+
+			// the histogram is read while it may still be written to, count what is actually there
+			std::array<std::uint32_t, std::tuple_size_v<decltype(entry.m_Histogram)>> histogram;
+			std::uint64_t total = 0;
+			for (std::size_t i = 0; i < histogram.size(); i++)
+				total += histogram[i] = entry.m_Histogram[i].load(std::memory_order_relaxed);
+
+			std::uint64_t p99 = 0, seen = 0;
+			for (std::size_t i = 0; i < histogram.size(); i++)
+			{
+				seen += histogram[i];
+				if (seen * 100 >= total * 99)
+				{
+					p99 = GetBucketUpperBound(i);
+					break;
+				}
+			}
+
+			const auto max = entry.m_MaxNs.load(std::memory_order_relaxed);
+			stats.push_back({entry.m_Name,
+			    entry.m_Category,
+			    calls,
+			    entry.m_TotalNs.load(std::memory_order_relaxed) / 1e6,
+			    max / 1e6,
+			    std::min(p99, max) / 1e6});
+		}
+		return stats;
+	}
+
+	void TickProfiler::ResetImpl()
+	{
+		std::lock_guard lock(m_Mutex);
+
+		for (auto& entry : m_Entries)
+		{
+			entry.m_Calls   = 0;
+			entry.m_TotalNs = 0;
+			entry.m_MaxNs   = 0;
+			for (auto& bucket : entry.m_Histogram)
+				bucket = 0;
+		}
+	}
+
+	bool TickProfiler::Dump(const std::filesystem::path& file)
+	{
+		auto stats = GetStats();
+		std::ranges::sort(stats, std::greater{}, &Stats::m_TotalMs);
+
+		std::ofstream stream(file, std::ios::trunc);
+		if (!stream)
+			return false;
+
+		stream << "[\n";
+		for (std::size_t i = 0; i < stats.size(); i++)
+		{
+			const auto& entry = stats[i];
+			stream << "  {\"name\": \"";
+			WriteJsonEscaped(stream, entry.m_Name);
+			stream << "\", \"category\": \"";
+			WriteJsonEscaped(stream, entry.m_Category);
+			stream << "\", \"calls\": " << entry.m_Calls << ", \"total_ms\": " << entry.m_TotalMs << ", \"avg_ms\": " << entry.AverageMs()
+			       << ", \"max_ms\": " << entry.m_MaxMs << ", \"p99_ms\": " << entry.m_P99Ms << "}" << (i + 1 < stats.size() ? ",\n" : "\n");
+		}
+		stream << "]\n";
+		return static_cast<bool>(stream.flush());
+	}
+}
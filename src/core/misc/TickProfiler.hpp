@@ -0,0 +1,129 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Always-on call statistics for the code we run on the game's script thread (looped commands, command
+	 * enable/disable and FiberPool jobs), cheap enough to leave on in release builds
+	 *
+	 * Every entry keeps a call count, total and maximum duration and a log-scale histogram from which percentiles
+	 * are estimated. Recording is a handful of relaxed atomic operations and never takes a lock.
+	 */
+	class TickProfiler
+	{
+	public:
+		class Entry
+		{
+		public:
+			Entry(std::string name, std::string_view category) :
+			    m_Name(std::move(name)),
+			    m_Category(category)
+			{
+			}
+
+			void Record(std::chrono::nanoseconds duration);
+
+		private:
+			friend class TickProfiler;
+
+			std::string m_Name;
+			std::string_view m_Category; // always a string literal
+			std::atomic<std::uint64_t> m_Calls{};
+			std::atomic<std::uint64_t> m_TotalNs{};
+			std::atomic<std::uint64_t> m_MaxNs{};
+			std::array<std::atomic<std::uint32_t>, 160> m_Histogram{}; // four buckets per power of two nanoseconds
+		};
+
+		struct Stats
+		{
+			std::string m_Name;
+			std::string_view m_Category;
+			std::uint64_t m_Calls;
+			double m_TotalMs;
+			double m_MaxMs;
+			double m_P99Ms;
+
+			double AverageMs() const
+			{
+				return m_Calls ? m_TotalMs / m_Calls : 0.0;
+			}
+		};
+
+		/**
+		 * @brief Returns the entry for a name, creating it on first use. Entries are never freed, cache the pointer
+		 * for anything that runs often.
+		 */
+		static Entry* GetEntry(std::string_view name, std::string_view category)
+		{
+			return GetInstance().GetEntryImpl(name, category);
+		}
+
+		/**
+		 * @brief Copies the statistics of every entry that has been called at least once
+		 */
+		static std::vector<Stats> GetStats()
+		{
+			return GetInstance().GetStatsImpl();
+		}
+
+		static void Reset()
+		{
+			GetInstance().ResetImpl();
+		}
+
+		/**
+		 * @brief Writes GetStats() as a JSON array
+		 */
+		static bool Dump(const std::filesystem::path& file);
+
+	private:
+		TickProfiler() = default;
+
+		Entry* GetEntryImpl(std::string_view name, std::string_view category);
+		std::vector<Stats> GetStatsImpl();
+		void ResetImpl();
+
+		static TickProfiler& GetInstance()
+		{
+			static TickProfiler i{};
+			return i;
+		}
+
+		std::mutex m_Mutex; // only guards creating and enumerating entries
+		std::deque<Entry> m_Entries;
+		std::unordered_map<std::string, Entry*> m_EntriesByName;
+	};
+
+	class ProfileScope
+	{
+	public:
+		explicit ProfileScope(TickProfiler::Entry* entry) :
+		    m_Entry(entry),
+		    m_Begin(std::chrono::steady_clock::now())
+		{
+		}
+
+		~ProfileScope()
+		{
+			m_Entry->Record(std::chrono::steady_clock::now() - m_Begin);
+		}
+
+		ProfileScope(const ProfileScope&)            = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		TickProfiler::Entry* m_Entry;
+		std::chrono::steady_clock::time_point m_Begin;
+	};
+}
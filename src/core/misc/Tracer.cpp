@@ -0,0 +1,129 @@
+#include "Tracer.hpp"
+#include "util/JsonEscape.hpp"
+
+#include <fstream>
+#include <thread>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define TRACER_TSC
+#endif
+
+namespace YimMenu
+{
+	thread_local Tracer::ThreadBuffer* Tracer::t_Buffer = nullptr;
+
+	Tracer::Tracer() :
+	    m_StartTicks(Now()),
+	    m_StartTime(std::chrono::steady_clock::now())
+	{
+	}
+
+	std::uint64_t Tracer::Now()
+	{
+#ifdef TRACER_TSC
+		return __rdtsc();
+#else
+		return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+	}
+
+	Tracer::ThreadBuffer& Tracer::GetThreadBuffer()
+	{
+		if (t_Buffer)
+			return *t_Buffer;
+
+		auto buffer     = std::make_unique<ThreadBuffer>();
+		buffer->m_Slots = std::make_unique<Slot[]>(g_BufferSize);
+
+		// buffers are never freed, the spans of threads that already exited are still worth dumping
+		std::lock_guard lock(m_Mutex);
+		buffer->m_Id   = static_cast<std::uint32_t>(m_Buffers.size() + 1);
+		buffer->m_Name = "Thread " + std::to_string(buffer->m_Id);
+		t_Buffer       = buffer.get();
+		m_Buffers.push_back(std::move(buffer));
+		return *t_Buffer;
+	}
+
+	void Tracer::Record(const char* name, std::uint64_t begin, std::uint64_t end)
+	{
+		auto& buffer     = GetInstance().GetThreadBuffer();
+		const auto index = buffer.m_Head.load(std::memory_order_relaxed);
+		auto& slot       = buffer.m_Slots[index & (g_BufferSize - 1)];
+
+		// per slot seqlock, the dumping thread discards slots that changed while it copied them
+		slot.m_Sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		slot.m_Event = {name, begin, end};
+		slot.m_Sequence.store(index + 1, std::memory_order_release);
+		buffer.m_Head.store(index + 1, std::memory_order_release);
+	}
+
+	void Tracer::SetThreadName(std::string name)
+	{
+		auto& instance = GetInstance();
+		auto& buffer   = instance.GetThreadBuffer();
+
+		std::lock_guard lock(instance.m_Mutex);
+		buffer.m_Name = std::move(name);
+	}
+
+	bool Tracer::Dump(const std::filesystem::path& file)
+	{
+		return GetInstance().DumpImpl(file);
+	}
+
+	bool Tracer::DumpImpl(const std::filesystem::path& file)
+	{
+		// calibrate the TSC against the steady clock over the whole lifetime of the tracer
+		const auto ticks      = Now() - m_StartTicks;
+		const auto elapsed    = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_StartTime).count();
+		const auto ticksPerUs = elapsed > 0 && ticks ? ticks / elapsed : 1.0;
+		const auto toUs       = [&](std::uint64_t tick) {
+			return (static_cast<double>(tick) - static_cast<double>(m_StartTicks)) / ticksPerUs;
+		};
+
+		std::ofstream stream(file, std::ios::trunc);
+		if (!stream)
+			return false;
+
+		stream << std::fixed;
+		stream.precision(3);
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		bool first = true;
+		std::lock_guard lock(m_Mutex);
+		for (const auto& buffer : m_Buffers)
+		{
+			stream << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->m_Id << ",\"args\":{\"name\":\"";
+			WriteJsonEscaped(stream, buffer->m_Name);
+			stream << "\"}}";
+			first = false;
+
+			const auto head = buffer->m_Head.load(std::memory_order_acquire);
+			for (auto index = head > g_BufferSize ? head - g_BufferSize : 0; index < head; index++)
+			{
+				auto& slot = buffer->m_Slots[index & (g_BufferSize - 1)];
+				if (slot.m_Sequence.load(std::memory_order_acquire) != index + 1)
+					continue;
+
+				const auto event = slot.m_Event;
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (slot.m_Sequence.load(std::memory_order_relaxed) != index + 1)
+					continue;
+
+				stream << ",\n{\"name\":\"";
+				WriteJsonEscaped(stream, event.m_Name);
+				stream << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->m_Id << ",\"ts\":" << toUs(event.m_Begin)
+				       << ",\"dur\":" << (event.m_End - event.m_Begin) / ticksPerUs << "}";
+			}
+		}
+
+		stream << "\n]}\n";
+		return static_cast<bool>(stream);
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Low overhead span recorder, exported as Chrome trace event JSON (chrome://tracing, ui.perfetto.dev)
+	 *
+	 * Every thread records into its own ring buffer of the most recent spans, so recording never takes a lock.
+	 * Timestamps are raw TSC reads that are only converted to microseconds when dumping.
+	 * Configure with -DTERMINUS_TRACING=OFF to compile all TRACE_ macros out.
+	 */
+	class Tracer
+	{
+	public:
+		struct Event
+		{
+			const char* m_Name; // must outlive the tracer, in practice a string literal
+			std::uint64_t m_Begin;
+			std::uint64_t m_End;
+		};
+
+		static std::uint64_t Now();
+
+		/**
+		 * @brief Records a finished span on the calling thread
+		 */
+		static void Record(const char* name, std::uint64_t begin, std::uint64_t end);
+
+		/**
+		 * @brief Names the calling thread in the exported trace
+		 */
+		static void SetThreadName(std::string name);
+
+		/**
+		 * @brief Writes every span still held by the thread buffers as Chrome trace event JSON
+		 *
+		 * Can be called while other threads keep recording, spans overwritten during the dump are skipped.
+		 */
+		static bool Dump(const std::filesystem::path& file);
+
+	private:
+		static constexpr std::size_t g_BufferSize = 1 << 15; // per thread, must be a power of two
+
+		struct Slot
+		{
+			std::atomic<std::uint64_t> m_Sequence; // index + 1 of the event in the slot, 0 while it is being written
+			Event m_Event;
+		};
+
+		struct ThreadBuffer
+		{
+			std::uint32_t m_Id;
+			std::string m_Name;
+			std::atomic<std::uint64_t> m_Head; // amount of events ever recorded
+			std::unique_ptr<Slot[]> m_Slots;
+		};
+
+		Tracer();
+
+		ThreadBuffer& GetThreadBuffer();
+		bool DumpImpl(const std::filesystem::path& file);
+
+		static Tracer& GetInstance()
+		{
+			static Tracer i{};
+			return i;
+		}
+
+		static thread_local ThreadBuffer* t_Buffer;
+
+		std::mutex m_Mutex; // only guards m_Buffers and their names
+		std::vector<std::unique_ptr<ThreadBuffer>> m_Buffers;
+		std::uint64_t m_StartTicks;
+		std::chrono::steady_clock::time_point m_StartTime;
+	};
+
+	class TraceSpan
+	{
+	public:
+		explicit TraceSpan(const char* name) :
+		    m_Name(name),
+		    m_Begin(Tracer::Now())
+		{
+		}
+
+		~TraceSpan()
+		{
+			Tracer::Record(m_Name, m_Begin, Tracer::Now());
+		}
+
+		TraceSpan(const TraceSpan&)            = delete;
+		TraceSpan& operator=(const TraceSpan&) = delete;
+
+	private:
+		const char* m_Name;
+		std::uint64_t m_Begin;
+	};
+}
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#ifdef TERMINUS_TRACING
+#define TRACE_SCOPE(name) ::YimMenu::TraceSpan TRACE_CONCAT(_traceSpan, __LINE__)(name)
+#define TRACE_FUNCTION() TRACE_SCOPE(__FUNCTION__)
+#define TRACE_THREAD_NAME(name) ::YimMenu::Tracer::SetThreadName(name)
+#else
+#define TRACE_SCOPE(name)
+#define TRACE_FUNCTION()
+#define TRACE_THREAD_NAME(name)
+#endif
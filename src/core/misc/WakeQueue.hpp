@@ -0,0 +1,126 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Round robin of items that may sleep until a point in time, like script fibers
+	 *
+	 * Sleeping items wait in a min-heap keyed by their wake time, so a tick only visits the runnable items and the
+	 * top of the heap, no matter how many items are asleep. Items always run in the order they were added.
+	 */
+	template<typename T, typename Clock = std::chrono::steady_clock>
+	class WakeQueue
+	{
+	public:
+		using TimePoint = typename Clock::time_point;
+
+		/**
+		 * @brief The item runs from the next tick on, safe to call from inside Tick()
+		 */
+		void Add(T* item)
+		{
+			m_Added.push_back({item, m_NextOrder++});
+		}
+
+		/**
+		 * @brief Wakes the items due at now, then calls run(item) for every runnable item
+		 *
+		 * run returns when the item wants to run next: std::nullopt for the next tick, a time point to sleep until,
+		 * or TimePoint::max() to drop the item for good.
+		 */
+		template<typename F>
+		void Tick(TimePoint now, F&& run)
+		{
+			WakeDue(now);
+
+			m_Next.clear();
+			for (const auto& entry : m_Runnable)
+			{
+				const std::optional<TimePoint> wake = run(entry.m_Item);
+				if (!wake)
+					m_Next.push_back(entry);
+				else if (*wake != TimePoint::max())
+				{
+					m_Sleeping.push_back({*wake, entry});
+					std::ranges::push_heap(m_Sleeping, std::greater{});
+				}
+			}
+			std::swap(m_Runnable, m_Next);
+		}
+
+		void Clear()
+		{
+			m_Runnable.clear();
+			m_Next.clear();
+			m_Added.clear();
+			m_Sleeping.clear();
+		}
+
+		std::size_t GetRunnableCount() const
+		{
+			return m_Runnable.size() + m_Added.size();
+		}
+
+		std::size_t GetSleepingCount() const
+		{
+			return m_Sleeping.size();
+		}
+
+	private:
+		struct Entry
+		{
+			T* m_Item;
+			std::uint64_t m_Order;
+
+			bool operator<(const Entry& other) const
+			{
+				return m_Order < other.m_Order;
+			}
+		};
+
+		struct Sleeper
+		{
+			TimePoint m_WakeTime;
+			Entry m_Entry;
+
+			bool operator>(const Sleeper& other) const
+			{
+				return m_WakeTime > other.m_WakeTime;
+			}
+		};
+
+		void WakeDue(TimePoint now)
+		{
+			const auto runnable = m_Runnable.size();
+
+			while (!m_Sleeping.empty() && m_Sleeping.front().m_WakeTime <= now)
+			{
+				std::ranges::pop_heap(m_Sleeping, std::greater{});
+				m_Runnable.push_back(m_Sleeping.back().m_Entry);
+				m_Sleeping.pop_back();
+			}
+
+			// the runnable items are sorted by order, only the woken ones have to be put in place
+			if (m_Runnable.size() != runnable)
+			{
+				std::sort(m_Runnable.begin() + runnable, m_Runnable.end());
+				std::inplace_merge(m_Runnable.begin(), m_Runnable.begin() + runnable, m_Runnable.end());
+			}
+
+			// added items have the highest order of all
+			m_Runnable.insert(m_Runnable.end(), m_Added.begin(), m_Added.end());
+			m_Added.clear();
+		}
+
+		std::vector<Entry> m_Runnable;
+		std::vector<Entry> m_Next;
+		std::vector<Entry> m_Added;
+		std::vector<Sleeper> m_Sleeping; // min-heap on the wake time
+		std::uint64_t m_NextOrder = 0;
+	};
+}
@@ -0,0 +1,253 @@
+#include "WorkerPool.hpp"
+#include "Tracer.hpp"
+
+#include <fstream>
+#include <utility>
+
+namespace YimMenu
+{
+	// set on the pool threads, a job pushing more jobs must not wait for room it takes up itself
+	static thread_local bool t_IsWorker = false;
+
+	void WorkerPool::InitImpl(int num_threads, std::size_t capacity)
+	{
+		std::lock_guard lock(m_Mutex);
+		m_Capacity = capacity;
+		m_Running  = true;
+		m_Stopping = false;
+
+		for (int i = 0; i < num_threads; i++)
+			m_Threads.emplace_back(&WorkerPool::RunWorker, this);
+	}
+
+	void WorkerPool::DestroyImpl()
+	{
+		{
+			// from here on new jobs run on whoever pushes them, the threads only drain what is queued
+			std::lock_guard lock(m_Mutex);
+			m_Stopping = true;
+			m_Running  = false;
+		}
+		m_WorkAvailable.notify_all();
+		m_SpaceAvailable.notify_all();
+
+		for (auto& thread : m_Threads)
+			thread.join();
+		m_Threads.clear();
+
+		// whatever they would have done on the script thread can't run anymore
+		std::lock_guard lock(m_CompletionMutex);
+		m_Completions.clear();
+	}
+
+	void WorkerPool::PushImpl(std::function<void()> work)
+	{
+		std::unique_lock lock(m_Mutex);
+		if (m_Running && !t_IsWorker && m_Jobs.size() >= m_Capacity)
+		{
+			m_Stalls++;
+			m_SpaceAvailable.wait(lock, [this] {
+				return m_Jobs.size() < m_Capacity || !m_Running;
+			});
+		}
+
+		if (!m_Running)
+		{
+			lock.unlock();
+			RunJob(work);
+			return;
+		}
+
+		m_Jobs.push_back(std::move(work));
+		lock.unlock();
+		m_WorkAvailable.notify_one();
+	}
+
+	void WorkerPool::PostCompletion(std::function<void()> completion)
+	{
+		std::lock_guard lock(m_CompletionMutex);
+		m_Completions.push_back(std::move(completion));
+	}
+
+	void WorkerPool::QueueFileOp(std::filesystem::path path, std::function<std::string()> serialize, std::function<void(bool)> done)
+	{
+		auto key = path.string();
+		{
+			std::lock_guard lock(m_FileMutex);
+			auto& op = m_FileOps[key];
+			if (op.m_Pending)
+				m_Coalesced++;
+
+			op.m_Path      = std::move(path);
+			op.m_Serialize = std::move(serialize);
+			op.m_Done      = std::move(done);
+			op.m_Pending   = true;
+
+			// the job that is already there picks up the new contents
+			if (std::exchange(op.m_Queued, true))
+				return;
+		}
+
+		PushImpl([this, key = std::move(key)] {
+			FlushFileOps(key);
+		});
+	}
+
+	void WorkerPool::FlushFileOps(const std::string& key)
+	{
+		std::unique_lock lock(m_FileMutex);
+		while (true)
+		{
+			auto& op = m_FileOps[key];
+			if (!op.m_Pending)
+			{
+				m_FileOps.erase(key);
+				return;
+			}
+
+			op.m_Pending   = false;
+			auto path      = op.m_Path;
+			auto serialize = std::move(op.m_Serialize);
+			auto done      = std::move(op.m_Done);
+			lock.unlock();
+
+			bool success = false;
+			bool threw   = false;
+			if (!serialize)
+			{
+				std::error_code ec;
+				std::filesystem::remove(path, ec);
+				success = !ec;
+			}
+			else
+			{
+				// a crash or unload halfway through leaves the old file intact
+				auto temp = path;
+				temp += ".tmp";
+
+				try
+				{
+					std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+					if (file.is_open())
+					{
+						file << serialize();
+						file.close();
+
+						std::error_code ec;
+						std::filesystem::rename(temp, path, ec);
+						success = !file.fail() && !ec;
+					}
+				}
+				catch (...)
+				{
+					// json::dump() throws on invalid UTF-8, the op must still be finished below or the path stays pending
+					threw = true;
+
+					std::error_code ec;
+					std::filesystem::remove(temp, ec);
+				}
+			}
+
+			if (done)
+				PostCompletion([done = std::move(done), success] {
+					done(success);
+				});
+
+			if (threw)
+			{
+				std::lock_guard failed_lock(m_Mutex);
+				m_Failed++;
+			}
+
+			lock.lock();
+			if (!threw)
+				m_FileWrites++;
+		}
+	}
+
+	bool WorkerPool::IsFilePendingImpl(const std::filesystem::path& path)
+	{
+		std::lock_guard lock(m_FileMutex);
+		return m_FileOps.contains(path.string());
+	}
+
+	void WorkerPool::RunCompletionsImpl()
+	{
+		{
+			std::lock_guard lock(m_CompletionMutex);
+			std::swap(m_Completions, m_RunningCompletions);
+		}
+
+		for (auto& completion : m_RunningCompletions)
+			RunJob(completion);
+		m_RunningCompletions.clear();
+	}
+
+	void WorkerPool::RunWorker()
+	{
+		TRACE_THREAD_NAME("Worker");
+		t_IsWorker = true;
+
+		std::unique_lock lock(m_Mutex);
+		while (true)
+		{
+			m_WorkAvailable.wait(lock, [this] {
+				return !m_Jobs.empty() || m_Stopping;
+			});
+
+			// stopping still drains the queue, that is what makes the saves on unload safe
+			if (m_Jobs.empty())
+				return;
+
+			auto job = std::move(m_Jobs.front());
+			m_Jobs.pop_front();
+			lock.unlock();
+			m_SpaceAvailable.notify_one();
+
+			{
+				TRACE_SCOPE("WorkerPool::Job");
+				RunJob(job);
+			}
+
+			lock.lock();
+		}
+	}
+
+	void WorkerPool::RunJob(std::function<void()>& job)
+	{
+		bool failed = false;
+		try
+		{
+			job();
+		}
+		catch (...)
+		{
+			failed = true;
+		}
+
+		std::lock_guard lock(m_Mutex);
+		(failed ? m_Failed : m_Completed)++;
+	}
+
+	WorkerPoolStats WorkerPool::GetStatsImpl()
+	{
+		WorkerPoolStats stats{};
+		{
+			std::lock_guard lock(m_Mutex);
+			stats.m_Queued    = m_Jobs.size();
+			stats.m_Completed = m_Completed;
+			stats.m_Failed    = m_Failed;
+			stats.m_Stalls    = m_Stalls;
+		}
+		{
+			std::lock_guard lock(m_FileMutex);
+			stats.m_FileWrites = m_FileWrites;
+			stats.m_Coalesced  = m_Coalesced;
+		}
+		{
+			std::lock_guard lock(m_CompletionMutex);
+			stats.m_PendingCompletions = m_Completions.size();
+		}
+		return stats;
+	}
+}
\ No newline at end of file
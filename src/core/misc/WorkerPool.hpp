@@ -0,0 +1,178 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace YimMenu
+{
+	struct WorkerPoolStats
+	{
+		std::size_t m_Queued;             // jobs waiting for a worker
+		std::size_t m_PendingCompletions; // results waiting for the next tick
+		std::uint64_t m_Completed;
+		std::uint64_t m_Failed;     // jobs and completions that threw
+		std::uint64_t m_Stalls;     // pushes that had to wait for room in the queue
+		std::uint64_t m_FileWrites; // files actually written or removed, see WriteFile()
+		std::uint64_t m_Coalesced;  // WriteFile() calls that were folded into a write that was already queued
+	};
+
+	/**
+	 * @brief A few threads for disk I/O and CPU heavy work, unlike the FiberPool jobs these must never call natives
+	 *
+	 * Results are handed back to the script thread through a completion queue that ScriptMgr drains at the start of
+	 * every tick. The job queue is bounded, pushing from outside the pool waits while it is full. Before Init() and
+	 * after Destroy() jobs run right away on the thread that pushes them.
+	 */
+	class WorkerPool
+	{
+	public:
+		static constexpr std::size_t g_DefaultCapacity = 256;
+
+		WorkerPool(const WorkerPool&)            = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+
+		static void Init(int num_threads, std::size_t capacity = g_DefaultCapacity)
+		{
+			GetInstance().InitImpl(num_threads, capacity);
+		}
+
+		/**
+		 * @brief Runs every queued job to completion and stops the threads, completions that did not run yet are dropped
+		 */
+		static void Destroy()
+		{
+			GetInstance().DestroyImpl();
+		}
+
+		static void Push(std::function<void()> work)
+		{
+			GetInstance().PushImpl(std::move(work));
+		}
+
+		/**
+		 * @brief Runs work on a worker, then completion(result) on the script thread
+		 *
+		 * If work throws, the failure is counted and completion never runs, so work that is waited on must not throw.
+		 */
+		template<typename Work, typename Completion>
+		static void Push(Work work, Completion completion)
+		{
+			GetInstance().PushImpl([work = std::move(work), completion = std::move(completion)]() mutable {
+				if constexpr (std::is_void_v<std::invoke_result_t<Work&>>)
+				{
+					work();
+					GetInstance().PostCompletion(std::move(completion));
+				}
+				else
+				{
+					GetInstance().PostCompletion([completion = std::move(completion), result = work()]() mutable {
+						completion(std::move(result));
+					});
+				}
+			});
+		}
+
+		/**
+		 * @brief Writes the file on a worker, replacing it only once the new contents are complete
+		 *
+		 * serialize runs on the worker, so it must only use state it owns, like a JSON snapshot taken by the caller.
+		 * Writes to the same path never overlap and a burst of them collapses into one write of the newest contents.
+		 * done(success) runs on the script thread, and only for writes that actually happened.
+		 */
+		static void WriteFile(std::filesystem::path path, std::function<std::string()> serialize, std::function<void(bool)> done = {})
+		{
+			GetInstance().QueueFileOp(std::move(path), std::move(serialize), std::move(done));
+		}
+
+		/**
+		 * @brief Deletes the file on a worker, ordered with the writes to the same path
+		 */
+		static void RemoveFile(std::filesystem::path path)
+		{
+			GetInstance().QueueFileOp(std::move(path), nullptr, {});
+		}
+
+		/**
+		 * @brief Whether a write or removal of the file is still queued or running, read it only once this is false
+		 */
+		static bool IsFilePending(const std::filesystem::path& path)
+		{
+			return GetInstance().IsFilePendingImpl(path);
+		}
+
+		/**
+		 * @brief Runs the completions of finished jobs, called by ScriptMgr once per tick
+		 */
+		static void RunCompletions()
+		{
+			GetInstance().RunCompletionsImpl();
+		}
+
+		static WorkerPoolStats GetStats()
+		{
+			return GetInstance().GetStatsImpl();
+		}
+
+	private:
+		WorkerPool() = default;
+
+		// the newest contents for a path, a null serializer removes the file
+		struct FileOp
+		{
+			std::filesystem::path m_Path;
+			std::function<std::string()> m_Serialize;
+			std::function<void(bool)> m_Done;
+			bool m_Pending = false;
+			bool m_Queued  = false; // a job for this path is queued or running
+		};
+
+		std::mutex m_Mutex;
+		std::condition_variable m_WorkAvailable;
+		std::condition_variable m_SpaceAvailable;
+		std::deque<std::function<void()>> m_Jobs;
+		std::vector<std::thread> m_Threads;
+		std::size_t m_Capacity = g_DefaultCapacity;
+		bool m_Running         = false;
+		bool m_Stopping        = false;
+
+		std::mutex m_CompletionMutex;
+		std::vector<std::function<void()>> m_Completions;
+		std::vector<std::function<void()>> m_RunningCompletions;
+
+		std::mutex m_FileMutex;
+		std::unordered_map<std::string, FileOp> m_FileOps; // keyed by the path
+
+		std::uint64_t m_Completed  = 0;
+		std::uint64_t m_Failed     = 0;
+		std::uint64_t m_Stalls     = 0;
+		std::uint64_t m_FileWrites = 0;
+		std::uint64_t m_Coalesced  = 0;
+
+		void InitImpl(int num_threads, std::size_t capacity);
+		void DestroyImpl();
+		void PushImpl(std::function<void()> work);
+		void PostCompletion(std::function<void()> completion);
+		void QueueFileOp(std::filesystem::path path, std::function<std::string()> serialize, std::function<void(bool)> done);
+		void FlushFileOps(const std::string& key);
+		bool IsFilePendingImpl(const std::filesystem::path& path);
+		void RunCompletionsImpl();
+		void RunWorker();
+		void RunJob(std::function<void()>& job);
+		WorkerPoolStats GetStatsImpl();
+
+		static WorkerPool& GetInstance()
+		{
+			static WorkerPool i{};
+			return i;
+		}
+	};
+}
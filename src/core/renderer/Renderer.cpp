@@ -3,6 +3,8 @@
 
 #include "core/memory/ModuleMgr.hpp"
 #include "core/memory/PatternScanner.hpp"
+#include "core/misc/StartupTimer.hpp"
+#include "core/misc/Tracer.hpp"
 #include "game/frontend/GUI.hpp"
 #include "game/frontend/Menu.hpp"
 #include "game/pointers/Pointers.hpp"
@@ -678,6 +680,8 @@ namespace YimMenu
 				ImGui_ImplVulkan_CreateFontsTexture();
 			}
 
+			TRACE_SCOPE("Renderer::Present");
+
 			ImGui_ImplVulkan_NewFrame();
 			ImGui_ImplWin32_NewFrame();
 			ImGui::NewFrame();
@@ -687,6 +691,9 @@ namespace YimMenu
 
 			ImGui::Render();
 
+			if (!m_RendererCallBacks.empty())
+				StartupTimer::FirstFrame();
+
 			ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), fd->CommandBuffer);
 
 			vkCmdEndRenderPass(fd->CommandBuffer);
@@ -759,6 +766,8 @@ namespace YimMenu
 
 	bool Renderer::InitImpl()
 	{
+		TRACE_SCOPE("Renderer::Init");
+
 		while (!*Pointers.Hwnd || !*Pointers.ScreenResX)
 		{
 			std::this_thread::sleep_for(1s);
@@ -814,10 +823,15 @@ namespace YimMenu
 
 	void Renderer::DX12OnPresentImpl()
 	{
+		TRACE_SCOPE("Renderer::Present");
+
 		Renderer::DX12NewFrame();
 		for (const auto& callback : m_RendererCallBacks | std::views::values)
 			callback();
 		Renderer::DX12EndFrame();
+
+		if (!m_RendererCallBacks.empty())
+			StartupTimer::FirstFrame();
 	}
 
 	LRESULT Renderer::WndProcImpl(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
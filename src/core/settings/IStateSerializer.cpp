@@ -9,4 +9,10 @@ namespace YimMenu
 	{
 		Settings::AddComponent(this);
 	}
+
+	void IStateSerializer::MarkStateDirty()
+	{
+		m_IsDirty = true;
+		Settings::RequestSave();
+	}
 }
\ No newline at end of file
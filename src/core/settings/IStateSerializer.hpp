@@ -5,7 +5,7 @@ namespace YimMenu
 	class IStateSerializer
 	{
 		std::string m_SerComponentName;
-		bool m_IsDirty;
+		std::atomic<bool> m_IsDirty;
 	public:
 		IStateSerializer(const std::string& name);
 		virtual void SaveStateImpl(nlohmann::json& state) = 0;
@@ -13,8 +13,9 @@ namespace YimMenu
 
 		inline void SaveState(nlohmann::json& state)
 		{
-			SaveStateImpl(state);
+			// cleared first so a change made while saving marks the component dirty again
 			m_IsDirty = false;
+			SaveStateImpl(state);
 		}
 
 		inline void LoadState(nlohmann::json& state)
@@ -28,10 +29,7 @@ namespace YimMenu
 			return m_IsDirty;
 		}
 
-		inline void MarkStateDirty()
-		{
-			m_IsDirty = true;
-		}
+		void MarkStateDirty();
 
 		inline const std::string& GetSerializerComponentName()
 		{
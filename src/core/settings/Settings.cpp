@@ -2,79 +2,206 @@
 
 #include "IStateSerializer.hpp"
 #include "Settings.hpp"
+#include "SettingsSnapshot.hpp"
+#include "core/misc/Tracer.hpp"
 
 
 namespace YimMenu
 {
+	// a burst of changes (dragging a slider, typing) is written once it has been quiet for this long...
+	static constexpr auto g_SaveDebounce = 500ms;
+	// ...but never later than this after the first change
+	static constexpr auto g_MaxSaveDelay = 5s;
+
 	Settings::Settings() :
 	    m_SettingsFile(),
 	    m_StateSerializers(),
-	    m_InitialLoadDone(false)
+	    m_InitialLoadDone(false),
+	    m_SaveRequested(false),
+	    m_LoadRequested(false),
+	    m_Stopping(false)
 	{
 	}
 
 	void Settings::InitializeImpl(File settingsFile)
 	{
+		TRACE_SCOPE("Settings::Initialize");
 		m_SettingsFile = settingsFile;
+		m_SnapshotFile = std::filesystem::path(m_SettingsFile).replace_extension(".bin");
 
 		if (!settingsFile.Exists())
 		{
 			Reset();
-			return;
+		}
+		else if (auto snapshot = SettingsSnapshot::Read(m_SnapshotFile, m_SettingsFile))
+		{
+			m_Json = std::move(*snapshot);
+			for (auto& serializer : m_StateSerializers)
+				LoadComponentImpl(serializer);
+
+			LOG(VERBOSE) << "All settings loaded from snapshot";
+			m_InitialLoadDone = true;
+		}
+		else
+		{
+			std::ifstream file(m_SettingsFile);
+
+			try
+			{
+				file >> m_Json;
+				file.close();
+
+				// missing or stale (the JSON was edited by hand), the next launch can take the fast path again
+				SettingsSnapshot::Write(m_SnapshotFile, m_SettingsFile, SettingsSnapshot::Encode(m_Json));
+
+				for (auto& serializer : m_StateSerializers)
+					LoadComponentImpl(serializer);
+
+				LOG(VERBOSE) << "All settings loaded";
+				m_InitialLoadDone = true;
+			}
+			catch (std::exception&)
+			{
+				LOG(WARNING) << "Detected corrupt settings, resetting settings...";
+				Reset();
+			}
 		}
 
-		std::ifstream file(m_SettingsFile);
+		m_Worker = std::thread(&Settings::RunWorker, this);
+	}
 
-		try
+	void Settings::DestroyImpl()
+	{
 		{
-			file >> m_Json;
-			file.close();
+			std::lock_guard lock(m_WakeMutex);
+			m_Stopping = true;
 		}
-		catch (std::exception&)
+		m_Wake.notify_one();
+
+		if (m_Worker.joinable())
+			m_Worker.join();
+	}
+
+	void Settings::RequestSaveImpl()
+	{
 		{
-			LOG(WARNING) << "Detected corrupt settings, resetting settings...";
-			Reset();
-			return;
+			std::lock_guard lock(m_WakeMutex);
+			m_SaveRequested = true;
 		}
+		m_Wake.notify_one();
+	}
 
-		for (auto& serializer : m_StateSerializers)
-			LoadComponentImpl(serializer);
+	void Settings::RunWorker()
+	{
+		TRACE_THREAD_NAME("Settings");
 
-		LOG(VERBOSE) << "All settings loaded";
-		m_InitialLoadDone = true;
+		std::unique_lock wake(m_WakeMutex);
+		while (true)
+		{
+			m_Wake.wait(wake, [this] {
+				return m_SaveRequested || m_LoadRequested || m_Stopping;
+			});
+
+			// components registered after the initial load shouldn't wait for the debounce
+			if (std::exchange(m_LoadRequested, false))
+			{
+				wake.unlock();
+				{
+					std::lock_guard lock(m_Mutex);
+					LoadLateComponents();
+				}
+				wake.lock();
+				continue;
+			}
+
+			// every new request restarts the quiet period, up to the deadline
+			const auto deadline = std::chrono::steady_clock::now() + g_MaxSaveDelay;
+			while (m_SaveRequested && !m_Stopping && std::chrono::steady_clock::now() < deadline)
+			{
+				m_SaveRequested = false;
+				m_Wake.wait_until(wake, std::min(std::chrono::steady_clock::now() + g_SaveDebounce, deadline), [this] {
+					return m_SaveRequested || m_Stopping;
+				});
+			}
+
+			m_SaveRequested     = false;
+			const bool stopping = m_Stopping;
+			wake.unlock();
+
+			{
+				std::unique_lock lock(m_Mutex);
+				Save(lock);
+			}
+
+			if (stopping)
+				return;
+
+			wake.lock();
+		}
 	}
 
-	void Settings::TickImpl()
+	void Settings::LoadLateComponents()
 	{
-		std::lock_guard lock(m_Mutex);
 		while (!m_LateLoaders.empty())
 		{
 			if (auto component = std::move(m_LateLoaders.front()))
 			{
-				LoadComponent(component);
+				LoadComponentImpl(component);
 			}
 
 			m_LateLoaders.pop();
 		}
+	}
 
-		if (m_InitialLoadDone && ShouldSave())
-		{
-			for (auto& serializer : m_StateSerializers)
-				if (serializer->IsStateDirty())
-					SaveComponentImpl(serializer);
+	void Settings::Save(std::unique_lock<std::mutex>& lock)
+	{
+		if (!m_InitialLoadDone || !ShouldSave())
+			return;
 
-			std::ofstream file(m_SettingsFile, std::ios::out | std::ios::trunc);
-			file << m_Json.dump(4);
-			file.close();
-		}
+		TRACE_SCOPE("Settings::Save");
+		for (auto& serializer : m_StateSerializers)
+			if (serializer->IsStateDirty())
+				SaveComponentImpl(serializer);
+
+		// don't hold up components registering while we're writing
+		const auto contents = m_Json.dump(4);
+		const auto snapshot = SettingsSnapshot::Encode(m_Json);
+		lock.unlock();
+
+		// write next to the old file and swap it in, a crash mid-write must not leave a truncated settings.json behind
+		auto temporary = m_SettingsFile;
+		temporary += ".tmp";
+		std::ofstream file(temporary, std::ios::out | std::ios::trunc | std::ios::binary);
+		const bool written = (file << contents).flush().good();
+		file.close();
+
+		std::error_code error;
+		if (!written)
+			LOG(WARNING) << "Failed to write " << temporary.filename();
+		else if (std::filesystem::rename(temporary, m_SettingsFile, error); error)
+			LOG(WARNING) << "Failed to replace settings file: " << error.message();
+		else
+			SettingsSnapshot::Write(m_SnapshotFile, m_SettingsFile, snapshot);
+
+		lock.lock();
 	}
 
 	void Settings::AddComponentImpl(IStateSerializer* serializer)
 	{
-		std::lock_guard lock(m_Mutex);
-		m_StateSerializers.push_back(serializer);
-		if (m_InitialLoadDone)
+		{
+			std::lock_guard lock(m_Mutex);
+			m_StateSerializers.push_back(serializer);
+			if (!m_InitialLoadDone)
+				return;
+
 			m_LateLoaders.push(serializer);
+		}
+
+		{
+			std::lock_guard lock(m_WakeMutex);
+			m_LoadRequested = true;
+		}
+		m_Wake.notify_one();
 	}
 
 	void Settings::LoadComponentImpl(IStateSerializer* serializer)
@@ -98,7 +225,7 @@ namespace YimMenu
 		std::ofstream file(m_SettingsFile, std::ios::out | std::ios::trunc);
 		file << "{}" << std::endl;
 		file.close();
-		m_Json = "{}";
+		m_Json = nlohmann::json::object();
 		m_InitialLoadDone = true;
 	}
 
@@ -1,20 +1,33 @@
 #pragma once
 #include "core/filemgr/File.hpp"
+#include <condition_variable>
 
 namespace YimMenu
 {
 	class IStateSerializer;
 
+	/**
+	 * @brief Owns settings.json, changes are written by a worker thread that sleeps until a component is marked dirty
+	 */
 	class Settings
 	{
 	private:
 		std::filesystem::path m_SettingsFile;
+		std::filesystem::path m_SnapshotFile;
 		std::vector<IStateSerializer*> m_StateSerializers;
 		std::queue<IStateSerializer*> m_LateLoaders;
 		bool m_InitialLoadDone;
 		nlohmann::json m_Json;
 		std::mutex m_Mutex;
 
+		// separate from m_Mutex so components can request a save from inside LoadState/SaveState
+		std::mutex m_WakeMutex;
+		std::condition_variable m_Wake;
+		bool m_SaveRequested;
+		bool m_LoadRequested;
+		bool m_Stopping;
+		std::thread m_Worker;
+
 	public:
 		Settings();
 
@@ -23,9 +36,20 @@ namespace YimMenu
 			GetInstance().InitializeImpl(settingsFile);
 		}
 
-		static void Tick()
+		/**
+		 * @brief Stops the worker, changes that are still being debounced are written first
+		 */
+		static void Destroy()
+		{
+			GetInstance().DestroyImpl();
+		}
+
+		/**
+		 * @brief Wakes the worker, the file is written once the changes have settled
+		 */
+		static void RequestSave()
 		{
-			GetInstance().TickImpl();
+			GetInstance().RequestSaveImpl();
 		}
 
 		static void AddComponent(IStateSerializer* serializer)
@@ -57,7 +81,11 @@ namespace YimMenu
 		}
 
 		void InitializeImpl(File settingsFile);
-		void TickImpl();
+		void DestroyImpl();
+		void RequestSaveImpl();
+		void RunWorker();
+		void LoadLateComponents();
+		void Save(std::unique_lock<std::mutex>& lock);
 		void AddComponentImpl(IStateSerializer* serializer);
 		void LoadComponentImpl(IStateSerializer* serializer);
 		void SaveComponentImpl(IStateSerializer* serializer);
@@ -0,0 +1,93 @@
+#include "SettingsSnapshot.hpp"
+#include "util/Crc32.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace YimMenu
+{
+#pragma pack(push, 1)
+	struct SettingsSnapshotHeader
+	{
+		std::uint32_t m_Magic;
+		std::uint32_t m_Version;
+		std::uint64_t m_SourceSize;
+		std::int64_t m_SourceWriteTime;
+		std::uint32_t m_PayloadSize;
+		std::uint32_t m_PayloadCrc;
+	};
+#pragma pack(pop)
+
+	static bool GetSourceInfo(const std::filesystem::path& source, std::uint64_t& size, std::int64_t& writeTime)
+	{
+		std::error_code ec;
+		size = std::filesystem::file_size(source, ec);
+		if (ec)
+			return false;
+
+		writeTime = std::filesystem::last_write_time(source, ec).time_since_epoch().count();
+		return !ec;
+	}
+
+	std::optional<nlohmann::json> SettingsSnapshot::Read(const std::filesystem::path& snapshot, const std::filesystem::path& source)
+	{
+		std::uint64_t size;
+		std::int64_t writeTime;
+		if (!GetSourceInfo(source, size, writeTime))
+			return std::nullopt;
+
+		std::ifstream stream(snapshot, std::ios_base::binary | std::ios_base::ate);
+		if (!stream)
+			return std::nullopt;
+
+		std::vector<std::uint8_t> buffer(static_cast<std::size_t>(stream.tellg()));
+		stream.seekg(0);
+		if (!stream.read(reinterpret_cast<char*>(buffer.data()), buffer.size()))
+			return std::nullopt;
+
+		SettingsSnapshotHeader header;
+		if (buffer.size() < sizeof(header))
+			return std::nullopt;
+		std::memcpy(&header, buffer.data(), sizeof(header));
+
+		if (header.m_Magic != Magic || header.m_Version != Version || header.m_SourceSize != size
+		    || header.m_SourceWriteTime != writeTime || buffer.size() != sizeof(header) + header.m_PayloadSize)
+			return std::nullopt;
+
+		const auto payload = std::span(buffer).subspan(sizeof(header));
+		if (Crc32(payload) != header.m_PayloadCrc)
+			return std::nullopt;
+
+		auto json = nlohmann::json::from_msgpack(payload, true, false);
+		if (json.is_discarded() || !json.is_object())
+			return std::nullopt;
+
+		return json;
+	}
+
+	std::vector<std::uint8_t> SettingsSnapshot::Encode(const nlohmann::json& json)
+	{
+		return nlohmann::json::to_msgpack(json);
+	}
+
+	bool SettingsSnapshot::Write(const std::filesystem::path& snapshot, const std::filesystem::path& source, std::span<const std::uint8_t> payload)
+	{
+		SettingsSnapshotHeader header{Magic, Version, 0, 0, static_cast<std::uint32_t>(payload.size()), Crc32(payload)};
+		if (!GetSourceInfo(source, header.m_SourceSize, header.m_SourceWriteTime))
+			return false;
+
+		auto temp = snapshot;
+		temp += ".tmp";
+		{
+			std::ofstream stream(temp, std::ios_base::binary | std::ios_base::trunc);
+			stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			stream.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+			if (!stream.flush())
+				return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temp, snapshot, ec);
+		return !ec;
+	}
+}
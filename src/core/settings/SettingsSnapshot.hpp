@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Binary (MessagePack) copy of settings.json that is much cheaper to load on injection
+	 * 
+	 * The JSON file stays the source of truth, the snapshot records the size and last write time of the JSON it
+	 * was made from and is ignored as soon as those no longer match (the user edited the file) or its payload fails
+	 * the checksum.
+	 */
+	class SettingsSnapshot
+	{
+	public:
+		static constexpr std::uint32_t Magic   = 0x31535354; // TSS1
+		static constexpr std::uint32_t Version = 1;
+
+		/**
+		 * @brief Reads the snapshot if it was written for the current contents of source
+		 */
+		static std::optional<nlohmann::json> Read(const std::filesystem::path& snapshot, const std::filesystem::path& source);
+
+		/**
+		 * @brief Serializes the document, cheap enough to do while holding the settings lock
+		 */
+		static std::vector<std::uint8_t> Encode(const nlohmann::json& json);
+
+		/**
+		 * @brief Writes an encoded document as the snapshot of source, call after source has been written
+		 */
+		static bool Write(const std::filesystem::path& snapshot, const std::filesystem::path& source, std::span<const std::uint8_t> payload);
+	};
+}
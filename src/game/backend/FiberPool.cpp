@@ -1,5 +1,11 @@
 #include "FiberPool.hpp"
 #include "ScriptMgr.hpp"
+#include "core/misc/FlightRecorder.hpp"
+#include "core/misc/Tracer.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <string>
 
 namespace YimMenu
 {
@@ -13,30 +19,38 @@ namespace YimMenu
 
 	void FiberPool::DestroyImpl()
 	{
-		std::lock_guard lock(m_Mutex);
-
-		while (!m_Jobs.empty())
-			m_Jobs.pop();
+		m_Jobs.Clear();
 	}
 
-	void FiberPool::PushImpl(std::function<void()> callback)
+	void FiberPool::PushImpl(std::function<void()> callback, JobPriority priority, const std::source_location& location)
 	{
-		std::lock_guard lock(m_Mutex);
-		m_Jobs.push(std::move(callback));
+		const auto& site = GetCallSite(location);
+		m_Jobs.Push({std::move(callback), site.m_Profile, site.m_File, location.line()}, priority);
 	}
 
-	void FiberPool::Tick()
+	const FiberPool::CallSite& FiberPool::GetCallSite(const std::source_location& location)
 	{
-		std::unique_lock lock(m_Mutex);
-
-		if (!m_Jobs.empty())
+		// file_name() of a call site always points at the same string, so its name is only built once
+		std::lock_guard lock(m_CallSitesMutex);
+		auto& site = m_CallSites[location.file_name()][location.line()];
+		if (!site.m_Profile)
 		{
-			auto job = std::move(m_Jobs.top());
-			m_Jobs.pop();
-			lock.unlock();
-
-			std::invoke(std::move(job));
+			const auto file = std::filesystem::path(location.file_name()).filename().string();
+			site.m_Profile  = TickProfiler::GetEntry(file + ":" + std::to_string(location.line()), "FiberPool");
+			site.m_File     = Joaat(file);
 		}
+		return site;
+	}
+
+	void FiberPool::Tick()
+	{
+		// the pool fibers all run on the game thread one after another, so they share the budget of a tick
+		m_Jobs.Drain(ScriptMgr::GetFrame(), [](Job& job) {
+			TRACE_SCOPE("FiberPool::Job");
+			FlightRecorder::Record(FlightEvent::FIBER_JOB, job.m_File, job.m_Line);
+			ProfileScope profile(job.m_Profile);
+			std::invoke(std::move(job.m_Callback));
+		});
 	}
 
 	void FiberPool::ScriptEntry()
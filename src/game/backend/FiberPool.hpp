@@ -1,4 +1,14 @@
 #pragma once
+#include "core/misc/JobQueue.hpp"
+#include "core/misc/TickProfiler.hpp"
+#include "util/Joaat.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <source_location>
+#include <unordered_map>
 
 namespace YimMenu
 {
@@ -23,18 +33,67 @@ namespace YimMenu
 			GetInstance().DestroyImpl();
 		}
 
-		static void Push(std::function<void()> callback)
+		/**
+		 * @brief Queues a job, the call site names it in the tick profiler
+		 */
+		static void Push(std::function<void()> callback, std::source_location location = std::source_location::current())
+		{
+			GetInstance().PushImpl(std::move(callback), JobPriority::INTERACTIVE, location);
+		}
+
+		/**
+		 * @brief Queues a job nobody is waiting on, interactive jobs go first
+		 */
+		static void Push(std::function<void()> callback, JobPriority priority, std::source_location location = std::source_location::current())
+		{
+			GetInstance().PushImpl(std::move(callback), priority, location);
+		}
+
+		/**
+		 * @brief Time the pool fibers together may spend on jobs per tick, every fiber still runs at least one
+		 */
+		static void SetTickBudget(std::chrono::microseconds budget)
+		{
+			GetInstance().m_Jobs.SetBudget(budget);
+		}
+
+		static JobQueueStats GetStats()
 		{
-			GetInstance().PushImpl(callback);
+			return GetInstance().m_Jobs.GetStats();
+		}
+
+		static void ResetPeaks()
+		{
+			GetInstance().m_Jobs.ResetPeaks();
 		}
 
 	private:
-		std::recursive_mutex m_Mutex{};
-		std::stack<std::function<void()>> m_Jobs{};
+		struct Job
+		{
+			std::function<void()> m_Callback;
+			TickProfiler::Entry* m_Profile = nullptr;
+			joaat_t m_File                 = 0; // call site for the flight recorder
+			std::uint32_t m_Line           = 0;
+		};
+
+		struct CallSite
+		{
+			TickProfiler::Entry* m_Profile = nullptr;
+			joaat_t m_File                 = 0;
+		};
+
+		static constexpr std::size_t g_Capacity = 1024; // per priority, more spills into a locked list
+		static constexpr auto g_DefaultTickBudget = std::chrono::milliseconds(2);
+
+		JobQueue<Job> m_Jobs{g_Capacity, g_DefaultTickBudget};
+
+		std::mutex m_CallSitesMutex;
+		std::unordered_map<const char*, std::unordered_map<std::uint32_t, CallSite>> m_CallSites; // keyed by file_name() and line
 
 		void InitImpl(int num_fibers);
 		void DestroyImpl();
-		void PushImpl(std::function<void()> callback);
+		void PushImpl(std::function<void()> callback, JobPriority priority, const std::source_location& location);
+		const CallSite& GetCallSite(const std::source_location& location);
 		void Tick();
 		static void ScriptEntry();
 
@@ -3,6 +3,7 @@
 #include "core/commands/Commands.hpp"
 #include "core/commands/BoolCommand.hpp"
 #include "core/filemgr/FileMgr.hpp"
+#include "core/misc/WorkerPool.hpp"
 #include "game/backend/ScriptMgr.hpp"
 #include "game/backend/Self.hpp"
 #include "game/backend/NativeHooks.hpp"
@@ -454,9 +455,8 @@ namespace YimMenu
 		{
 			if (*m_LoadedMapName != m_Info.m_Name)
 			{
-				auto old_file = maps_folder.Path() / (*m_LoadedMapName + ".json");
-				if (std::filesystem::exists(old_file))
-					std::filesystem::remove(old_file);
+				// through the pool, so it can't race a write of the old name that is still queued
+				WorkerPool::RemoveFile(maps_folder.Path() / (*m_LoadedMapName + ".json"));
 			}
 		}
 
@@ -474,14 +474,15 @@ namespace YimMenu
 		}
 
 		auto out_path = maps_folder.Path() / (m_Info.m_Name + ".json");
-		std::ofstream out_map(out_path, std::ios::trunc);
-		if (!out_map.good())
-		{
-			LOG(WARNING) << "MapEditor::SaveMap: failed to open " << out_path.string();
-			return;
-		}
-		out_map << object.dump(4);
-		out_map.close();
+		WorkerPool::WriteFile(
+		    out_path,
+		    [object = std::move(object)] {
+			    return object.dump(4);
+		    },
+		    [out_path](bool success) {
+			    if (!success)
+				    LOG(WARNING) << "MapEditor::SaveMap: failed to write " << out_path.string();
+		    });
 
 		m_LoadedMapName = m_Info.m_Name;
 	}
@@ -491,22 +492,53 @@ namespace YimMenu
 		Folder maps_folder = FileMgr::GetProjectFolder("./maps/");
 		FileMgr::CreateFolderIfNotExists(maps_folder);
 
-		// let's see if the map actually exists first
 		auto in_path = maps_folder.Path() / (std::string(name) + ".json");
+
+		// the map may have just been saved, the file isn't complete before that write is done
+		while (WorkerPool::IsFilePending(in_path))
+			ScriptMgr::Yield();
+
+		// let's see if the map actually exists first
 		if (!std::filesystem::exists(in_path))
 			return false;
 
+		// reading and parsing a big map takes a while, the game keeps running until the worker is done with it
+		std::optional<nlohmann::json> parsed;
+		bool done = false;
+		WorkerPool::Push(
+		    [in_path]() -> std::optional<nlohmann::json> {
+			    // the completion below must always arrive, we wait for it
+			    try
+			    {
+				    std::ifstream in_map(in_path);
+				    auto object = nlohmann::json::parse(in_map, nullptr, false);
+				    if (object.is_discarded())
+					    return std::nullopt;
+				    return object;
+			    }
+			    catch (...)
+			    {
+				    return std::nullopt;
+			    }
+		    },
+		    [&parsed, &done](std::optional<nlohmann::json> result) {
+			    parsed = std::move(result);
+			    done   = true;
+		    });
+
+		while (!done)
+			ScriptMgr::Yield();
+
 		// clear existing objects
 		ResetMapImpl();
 
 		// now we load the map. Assume anything can happen from here on out
 		try
 		{
-			nlohmann::json object;
+			if (!parsed)
+				throw std::exception("failed to parse the file");
 
-			std::ifstream in_map(in_path);
-			object << in_map;
-			in_map.close();
+			auto& object = *parsed;
 
 			int largest_id = 0;
 
@@ -548,9 +580,8 @@ namespace YimMenu
 		Folder maps_folder = FileMgr::GetProjectFolder("./maps/");
 		FileMgr::CreateFolderIfNotExists(maps_folder);
 
-		auto in_path = maps_folder.Path() / (std::string(name) + ".json");
-		if (std::filesystem::exists(in_path))
-			std::filesystem::remove(in_path);
+		// ordered after a save of the same map that may still be queued, otherwise that write recreates the file
+		WorkerPool::RemoveFile(maps_folder.Path() / (std::string(name) + ".json"));
 
 		std::erase(m_MapsAvailable, name);
 	}
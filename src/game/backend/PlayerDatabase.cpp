@@ -1,5 +1,7 @@
 #include "PlayerDatabase.hpp"
 #include "Detections.hpp"
+#include "core/misc/Tracer.hpp"
+#include "core/misc/WorkerPool.hpp"
 
 namespace YimMenu
 {
@@ -8,6 +10,7 @@ namespace YimMenu
 	PlayerDatabase::PlayerDatabase() :
 	    m_File(std::filesystem::path(std::getenv("appdata")) / "HorseMenu" / "database.json")
 	{
+		TRACE_SCOPE("PlayerDatabase::Load");
 		Load();
 
 		g_PlayerDatabase = this;
@@ -57,7 +60,7 @@ namespace YimMenu
 
 	void PlayerDatabase::Save()
 	{
-		// TODO: save in thread pool
+		// the players are changed from the game thread, so the snapshot is taken here and only written by the pool
 		json data;
 
 		for (auto& [rid, player] : m_Data)
@@ -65,14 +68,15 @@ namespace YimMenu
 			data[std::to_string(rid)] = player;
 		}
 
-		std::ofstream fileStream(m_File);
-		if (fileStream.is_open())
-		{
-			fileStream << std::setw(4) << data << std::endl;
-			fileStream.close();
-		}
-		else
-			LOG(WARNING) << "Unable to save Player Database!";
+		WorkerPool::WriteFile(
+		    m_File,
+		    [data = std::move(data)] {
+			    return data.dump(4) + "\n";
+		    },
+		    [](bool success) {
+			    if (!success)
+				    LOG(WARNING) << "Unable to save Player Database!";
+		    });
 	}
 
 	std::shared_ptr<persistent_player> PlayerDatabase::GetPlayer(uint64_t rid)
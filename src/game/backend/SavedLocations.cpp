@@ -1,6 +1,7 @@
 #include "SavedLocations.hpp"
 #include "core/filemgr/FileMgr.hpp"
 #include "core/frontend/Notifications.hpp"
+#include "core/misc/WorkerPool.hpp"
 
 namespace YimMenu
 {
@@ -9,6 +10,19 @@ namespace YimMenu
 		return FileMgr::GetProjectFile("./telelocations.json").Path();
 	}
 
+	void SavedLocations::WriteSavedLocations(const std::filesystem::path& path)
+	{
+		WorkerPool::WriteFile(
+		    path,
+		    [j = nlohmann::json(m_AllSavedLocations)] {
+			    return j.dump(4);
+		    },
+		    [](bool success) {
+			    if (!success)
+				    LOG(WARNING) << "Unable to save the teleport locations";
+		    });
+	}
+
 	std::vector<SavedLocation> SavedLocations::SavedLocationsFilteredListImpl(std::string filter)
 	{
 		std::vector<SavedLocation> filterList{};
@@ -62,14 +76,7 @@ namespace YimMenu
 
 		auto path = GetSavedLocationsFilePath();
 
-		std::ofstream fileOut(path, std::ofstream::trunc | std::ofstream::binary);
-		if (!fileOut.is_open())
-			return false;
-
-		nlohmann::json j = m_AllSavedLocations;
-		fileOut << j.dump(4);
-		fileOut.close();
-
+		WriteSavedLocations(path);
 		return true;
 	}
 
@@ -90,14 +97,7 @@ namespace YimMenu
 			m_AllSavedLocations.erase(category);
 		}
 
-		std::ofstream fileOut(path, std::ofstream::trunc | std::ofstream::binary);
-		if (!fileOut.is_open())
-			return false;
-
-		nlohmann::json j = m_AllSavedLocations;
-		fileOut << j.dump(4);
-		fileOut.close();
-
+		WriteSavedLocations(path);
 		return true;
 	}
 
@@ -16,6 +16,7 @@ namespace YimMenu
 	{
 	private:
 		std::filesystem::path GetSavedLocationsFilePath();
+		void WriteSavedLocations(const std::filesystem::path& path);
 		std::map<std::string, std::vector<SavedLocation>> m_AllSavedLocations;
 
 	private:
@@ -1,5 +1,6 @@
 #include "SavedVariables.hpp"
 #include "core/filemgr/FileMgr.hpp"
+#include "core/misc/WorkerPool.hpp"
 #include "game/backend/Self.hpp"
 #include "game/rdr/ScriptGlobal.hpp"
 #include <script/scrThread.hpp>
@@ -91,8 +92,8 @@ namespace YimMenu
 		vars["globals"] = m_SavedGlobals;
 		vars["locals"]  = m_SavedLocals;
 		auto file       = FileMgr::GetProjectFile("./variables.json");
-		std::ofstream offstream_file(file.Path(), std::ios::out | std::ios::trunc);
-		offstream_file << vars.dump(4);
-		offstream_file.close();
+		WorkerPool::WriteFile(file.Path(), [vars = std::move(vars)] {
+			return vars.dump(4);
+		});
 	}
 }
\ No newline at end of file
@@ -1,49 +1,40 @@
 #include "ScriptMgr.hpp"
-#include "game/rdr/Scripts.hpp"
+#include "core/misc/FlightRecorder.hpp"
+#include "core/misc/Tracer.hpp"
+#include "core/misc/WorkerPool.hpp"
+
+#include <filesystem>
+#include <string>
 
 namespace YimMenu
 {
+	static thread_local Script* t_CurrentScript = nullptr;
+
 	Script::Script(std::function<void()> callback) :
 	    m_Callback(callback),
 	    m_Done(false),
-	    m_ChildFiber(0),
-	    m_MainFiber(0),
-	    m_WakeTime(std::nullopt)
-	{
-		m_ChildFiber = CreateFiber(
-		    0,
-		    [](void* param) {
-			    auto this_script = static_cast<Script*>(param);
-			    this_script->m_Callback();
-			    this_script->m_Done = true;
-			    SwitchToFiber(this_script->m_MainFiber);
-		    },
-		    this);
-	}
-
-	Script::~Script()
+	    m_WakeTime(std::nullopt),
+	    m_Profile(nullptr),
+	    m_Fiber([this] {
+		    m_Callback();
+		    m_Done = true;
+	    })
 	{
-		if (m_ChildFiber)
-			DeleteFiber(m_ChildFiber);
 	}
 
 	void Script::Tick()
 	{
-		m_MainFiber = GetCurrentFiber();
-		if ((!m_WakeTime.has_value() || m_WakeTime.value() <= std::chrono::high_resolution_clock::now()) && !m_Done)
+		if (!m_Done)
 		{
-			SwitchToFiber(m_ChildFiber);
+			TRACE_SCOPE("Script::Tick"); // the time spent in the script fiber until it yields
+			m_Fiber.Resume();
 		}
 	}
 
-	void Script::Yield(std::optional<std::chrono::high_resolution_clock::duration> time)
+	void Script::Yield(std::optional<std::chrono::high_resolution_clock::time_point> wake_time)
 	{
-		if (time.has_value())
-			m_WakeTime = std::chrono::high_resolution_clock::now() + time.value();
-		else
-			m_WakeTime = std::nullopt;
-
-		SwitchToFiber(m_MainFiber);
+		m_WakeTime = wake_time;
+		Fiber::Suspend();
 	}
 
 	void ScriptMgr::InitImpl()
@@ -54,38 +45,63 @@ namespace YimMenu
 	void ScriptMgr::DestroyImpl()
 	{
 		std::lock_guard lock(m_Mutex);
+		m_Queue.Clear();
 		m_Scripts.clear();
+		m_Tasks.Clear();
 	}
 
-	void ScriptMgr::TickImpl()
+	void ScriptMgr::TickImpl(std::chrono::high_resolution_clock::time_point now)
 	{
-		auto startup = Scripts::FindScriptThread("startup"_J);
+		TRACE_SCOPE("ScriptMgr::Tick");
+		FlightRecorder::Record(FlightEvent::FRAME, m_Frame++);
 
-		if (startup)
-		{
-			static bool enable = ([this] {
-				m_CanTick = true;
-			}(), true);
+		// before taking the lock, completions may add scripts
+		WorkerPool::RunCompletions();
 
-			Scripts::RunAsScript(startup, [this]() {
-				std::lock_guard lock(m_Mutex);
-				static bool ensure_main_fiber = (ConvertThreadToFiber(nullptr), true);
+		std::lock_guard lock(m_Mutex);
+		m_CanTick  = true;
+		m_TickTime = now;
 
-				for (const auto& script : m_Scripts)
-					script->Tick();
-			});
-		}
+		// the scheduler decides who is due against the time of the tick, the scripts never read the clock themselves
+		m_Queue.Tick(now, [](Script* script) -> std::optional<std::chrono::high_resolution_clock::time_point> {
+			{
+				ProfileScope profile(script->m_Profile);
+				t_CurrentScript = script;
+				script->Tick();
+				t_CurrentScript = nullptr;
+			}
+
+			if (script->m_Done)
+				return std::chrono::high_resolution_clock::time_point::max();
+			return script->m_WakeTime;
+		});
+
+		m_Tasks.Tick(now, [this](std::exception_ptr error) {
+			if (m_TaskErrorHandler)
+				m_TaskErrorHandler(error);
+		});
 	}
 
 	void ScriptMgr::YieldImpl(std::optional<std::chrono::high_resolution_clock::duration> time)
 	{
-		if (auto script = static_cast<Script*>(GetFiberData()))
-			script->Yield(time);
+		// only a script fiber can yield, from anywhere else this is a no-op
+		const auto script = t_CurrentScript;
+		if (!script || Fiber::Current() != &script->m_Fiber)
+			return;
+
+		if (time.has_value())
+			script->Yield(m_TickTime + time.value());
+		else
+			script->Yield();
 	}
 
-	void ScriptMgr::AddScriptImpl(std::unique_ptr<Script> script)
+	void ScriptMgr::AddScriptImpl(std::unique_ptr<Script> script, const std::source_location& location)
 	{
+		const auto file   = std::filesystem::path(location.file_name()).filename().string();
+		script->m_Profile = TickProfiler::GetEntry(file + ":" + std::to_string(location.line()), "Script");
+
 		std::lock_guard lock(m_Mutex);
+		m_Queue.Add(script.get());
 		m_Scripts.push_back(std::move(script));
 	}
 }
\ No newline at end of file
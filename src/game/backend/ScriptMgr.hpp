@@ -1,4 +1,18 @@
 #pragma once
+#include "core/misc/Fiber.hpp"
+#include "core/misc/TaskScheduler.hpp"
+#include "core/misc/TickProfiler.hpp"
+#include "core/misc/WakeQueue.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <source_location>
+#include <vector>
 
 namespace YimMenu
 {
@@ -7,16 +21,15 @@ namespace YimMenu
 	public:
 		std::function<void()> m_Callback;
 		bool m_Done;
-		HANDLE m_ChildFiber;
-		HANDLE m_MainFiber;
 		std::optional<std::chrono::high_resolution_clock::time_point> m_WakeTime;
+		TickProfiler::Entry* m_Profile; // time spent in the fiber per tick, named after the AddScript() call site
+		Fiber m_Fiber;
 
 		public:
 		explicit Script(std::function<void()> callback);
-		~Script();
 
 		void Tick();
-		void Yield(std::optional<std::chrono::high_resolution_clock::duration> time = std::nullopt);
+		void Yield(std::optional<std::chrono::high_resolution_clock::time_point> wake_time = std::nullopt);
 	};
 
 	class ScriptMgr
@@ -45,9 +58,20 @@ namespace YimMenu
 			GetInstance().DestroyImpl();
 		}
 
+		/**
+		 * @brief Runs every script that is due, must be called once per game tick from the thread that owns the scripts
+		 */
 		static void Tick()
 		{
-			GetInstance().TickImpl();
+			GetInstance().TickImpl(std::chrono::high_resolution_clock::now());
+		}
+
+		/**
+		 * @brief Same as Tick() with the time of the tick given, lets a simulated driver tick the scripts with a fake clock
+		 */
+		static void Tick(std::chrono::high_resolution_clock::time_point now)
+		{
+			GetInstance().TickImpl(now);
 		}
 
 		static void Yield(std::optional<std::chrono::high_resolution_clock::duration> time = std::nullopt)
@@ -55,9 +79,41 @@ namespace YimMenu
 			GetInstance().YieldImpl(time);
 		}
 
-		static void AddScript(std::unique_ptr<Script> script)
+		static void AddScript(std::unique_ptr<Script> script, std::source_location location = std::source_location::current())
+		{
+			GetInstance().AddScriptImpl(std::move(script), location);
+		}
+
+		/**
+		 * @brief Runs a coroutine on the game thread from the next tick on, see NextTick() and Sleep() for what it can await
+		 */
+		static void Spawn(Task<> task)
+		{
+			GetInstance().m_Tasks.Spawn(std::move(task));
+		}
+
+		/**
+		 * @brief Called on the game thread with the exception of every task that failed, without one failures are dropped
+		 */
+		static void SetTaskErrorHandler(std::function<void(std::exception_ptr)> handler)
+		{
+			GetInstance().m_TaskErrorHandler = std::move(handler);
+		}
+
+		/**
+		 * @brief Resumes a suspended coroutine on a later tick, used by the awaitables
+		 */
+		static void Schedule(std::coroutine_handle<> handle, std::optional<std::chrono::high_resolution_clock::time_point> wake_time = std::nullopt)
+		{
+			GetInstance().m_Tasks.Schedule(handle, wake_time);
+		}
+
+		/**
+		 * @brief Time of the tick that is running, sleeps count from here
+		 */
+		static std::chrono::high_resolution_clock::time_point GetTickTime()
 		{
-			GetInstance().AddScriptImpl(std::move(script));
+			return GetInstance().m_TickTime;
 		}
 
 		static bool CanTick()
@@ -65,16 +121,29 @@ namespace YimMenu
 			return GetInstance().m_CanTick;
 		}
 
+		/**
+		 * @brief Number of the current tick, counts up by one every time the scripts are ticked
+		 */
+		static std::uint64_t GetFrame()
+		{
+			return GetInstance().m_Frame;
+		}
+
 	private:
 		std::mutex m_Mutex;
 		std::vector<std::unique_ptr<Script>> m_Scripts;
+		WakeQueue<Script, std::chrono::high_resolution_clock> m_Queue; // only the scripts that are awake get ticked
+		TaskScheduler<std::chrono::high_resolution_clock> m_Tasks;
+		std::function<void(std::exception_ptr)> m_TaskErrorHandler;
 		bool m_CanTick = false;
+		std::uint64_t m_Frame = 0;
+		std::chrono::high_resolution_clock::time_point m_TickTime; // Yield() durations count from here
 
 		void InitImpl();
 		void DestroyImpl();
-		void TickImpl();
+		void TickImpl(std::chrono::high_resolution_clock::time_point now);
 		void YieldImpl(std::optional<std::chrono::high_resolution_clock::duration> time = std::nullopt);
-		void AddScriptImpl(std::unique_ptr<Script> script);
+		void AddScriptImpl(std::unique_ptr<Script> script, const std::source_location& location);
 
 		static ScriptMgr& GetInstance()
 		{
@@ -82,4 +151,54 @@ namespace YimMenu
 			return i;
 		}
 	};
+
+	/**
+	 * @brief co_await NextTick() suspends a task until the next tick
+	 */
+	inline auto NextTick()
+	{
+		struct Awaiter
+		{
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			void await_suspend(std::coroutine_handle<> handle) const
+			{
+				ScriptMgr::Schedule(handle);
+			}
+
+			void await_resume() const noexcept
+			{
+			}
+		};
+		return Awaiter{};
+	}
+
+	/**
+	 * @brief co_await Sleep(time) suspends a task until the first tick at least time after the current one
+	 */
+	inline auto Sleep(std::chrono::high_resolution_clock::duration time)
+	{
+		struct Awaiter
+		{
+			std::chrono::high_resolution_clock::duration m_Time;
+
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			void await_suspend(std::coroutine_handle<> handle) const
+			{
+				ScriptMgr::Schedule(handle, ScriptMgr::GetTickTime() + m_Time);
+			}
+
+			void await_resume() const noexcept
+			{
+			}
+		};
+		return Awaiter{time};
+	}
 }
\ No newline at end of file
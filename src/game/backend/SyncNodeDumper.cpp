@@ -0,0 +1,139 @@
+#include "SyncNodeDumper.hpp"
+
+#include <charconv>
+
+namespace YimMenu
+{
+	template<typename T>
+	static T Load(const std::uint8_t* data)
+	{
+		T value;
+		std::memcpy(&value, data, sizeof(T));
+		return value;
+	}
+
+	template<typename T>
+	static void AppendNumber(std::string& out, T value, SyncFieldFormat format = SyncFieldFormat::DEFAULT)
+	{
+		char buffer[32];
+		std::to_chars_result result;
+		if constexpr (std::is_integral_v<T>)
+		{
+			if (format == SyncFieldFormat::HEX)
+			{
+				out += "0x";
+				result = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<std::make_unsigned_t<T>>(value), 16);
+				for (auto c = buffer; c != result.ptr; c++)
+					*c = static_cast<char>(*c >= 'a' ? *c - 'a' + 'A' : *c);
+			}
+			else
+				result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+		}
+		else
+			result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+		out.append(buffer, result.ptr);
+	}
+
+	static void AppendVector(std::string& out, const std::uint8_t* data, int components)
+	{
+		static constexpr const char* labels[] = {"X: ", " Y: ", " Z: ", " W: "};
+		for (int i = 0; i < components; i++)
+		{
+			out += labels[i];
+			AppendNumber(out, Load<float>(data + i * sizeof(float)));
+		}
+	}
+
+	static void AppendRaw(std::string& out, SyncFieldType type, SyncFieldFormat format, const std::uint8_t* data)
+	{
+		switch (type)
+		{
+		case SyncFieldType::BOOL: out += Load<bool>(data) ? "YES" : "NO"; break;
+		case SyncFieldType::INT8: AppendNumber(out, Load<std::int8_t>(data), format); break;
+		case SyncFieldType::INT16: AppendNumber(out, Load<std::int16_t>(data), format); break;
+		case SyncFieldType::INT32: AppendNumber(out, Load<std::int32_t>(data), format); break;
+		case SyncFieldType::INT64: AppendNumber(out, Load<std::int64_t>(data), format); break;
+		case SyncFieldType::UINT8: AppendNumber(out, Load<std::uint8_t>(data), format); break;
+		case SyncFieldType::UINT16: AppendNumber(out, Load<std::uint16_t>(data), format); break;
+		case SyncFieldType::UINT32: AppendNumber(out, Load<std::uint32_t>(data), format); break;
+		case SyncFieldType::UINT64: AppendNumber(out, Load<std::uint64_t>(data), format); break;
+		case SyncFieldType::FLOAT: AppendNumber(out, Load<float>(data)); break;
+		case SyncFieldType::VEC3: AppendVector(out, data, 3); break;
+		case SyncFieldType::VEC4: AppendVector(out, data, 4); break;
+		}
+	}
+
+	void SyncNodeDumper::AppendField(std::string& out, std::string_view name, const SyncField& field, const std::uint8_t* data)
+	{
+		out += "\n\t";
+		out += name;
+		out += ": ";
+
+		if (field.m_Count == 1)
+		{
+			AppendRaw(out, field.m_Type, field.m_Format, data + field.m_Offset);
+			return;
+		}
+
+		out += '[';
+		for (std::uint32_t i = 0; i < field.m_Count; i++)
+		{
+			if (i)
+				out += ", ";
+			AppendRaw(out, field.m_Type, field.m_Format, data + field.m_Offset + i * field.m_Stride);
+		}
+		out += ']';
+	}
+
+	void SyncNodeDumper::Format(std::string& out, const SyncNodeLayout& layout, const std::uint8_t* data)
+	{
+		for (const auto& field : layout.m_Fields)
+			AppendField(out, field.m_Name, field, data);
+
+		if (layout.m_Extra)
+			layout.m_Extra(out, data);
+	}
+
+	void SyncNodeDumper::Capture(const CaptureHeader& header, const std::uint8_t* data)
+	{
+		auto& instance = GetInstance();
+		std::lock_guard lock(instance.m_CaptureMutex);
+
+		// once a buffer is full it becomes the previous one, so between one and two buffers of history are kept
+		auto& capture = instance.m_Capture;
+		if (capture.size() + sizeof(header) + header.m_Size > g_CaptureBufferSize)
+		{
+			std::swap(capture, instance.m_PreviousCapture);
+			capture.clear();
+		}
+
+		if (capture.capacity() < g_CaptureBufferSize)
+			capture.reserve(g_CaptureBufferSize);
+
+		const auto offset = capture.size();
+		capture.resize(offset + sizeof(header) + header.m_Size);
+		std::memcpy(capture.data() + offset, &header, sizeof(header));
+		if (header.m_Size)
+			std::memcpy(capture.data() + offset + sizeof(header), data, header.m_Size);
+	}
+
+	void SyncNodeDumper::ClearCapture()
+	{
+		auto& instance = GetInstance();
+		std::lock_guard lock(instance.m_CaptureMutex);
+		instance.m_Capture.clear();
+		instance.m_PreviousCapture.clear();
+	}
+
+	std::vector<std::uint8_t> SyncNodeDumper::GetCapture()
+	{
+		auto& instance = GetInstance();
+		std::lock_guard lock(instance.m_CaptureMutex);
+
+		std::vector<std::uint8_t> capture;
+		capture.reserve(instance.m_PreviousCapture.size() + instance.m_Capture.size());
+		capture.insert(capture.end(), instance.m_PreviousCapture.begin(), instance.m_PreviousCapture.end());
+		capture.insert(capture.end(), instance.m_Capture.begin(), instance.m_Capture.end());
+		return capture;
+	}
+}
@@ -0,0 +1,208 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace YimMenu
+{
+	enum class SyncFieldType : std::uint8_t
+	{
+		BOOL,
+		INT8,
+		INT16,
+		INT32,
+		INT64,
+		UINT8,
+		UINT16,
+		UINT32,
+		UINT64,
+		FLOAT,
+		VEC3,
+		VEC4
+	};
+
+	enum class SyncFieldFormat : std::uint8_t
+	{
+		DEFAULT,
+		HEX
+	};
+
+	/**
+	 * @brief Where a field lives in the data of a sync node and how to print it, see SYNC_FIELD()
+	 */
+	struct SyncField
+	{
+		const char* m_Name;
+		std::uint32_t m_Offset;
+		SyncFieldType m_Type;
+		SyncFieldFormat m_Format = SyncFieldFormat::DEFAULT;
+		std::uint16_t m_Count    = 1; // more than one prints an array of m_Count values m_Stride bytes apart
+		std::uint16_t m_Stride   = 0;
+	};
+
+	// prints the parts of a node that the table can't describe, like arrays with a count stored in the node
+	using SyncNodeFormatter = void (*)(std::string& out, const std::uint8_t* data);
+
+	struct SyncNodeLayout
+	{
+		std::uint32_t m_Id;
+		std::span<const SyncField> m_Fields;
+		SyncNodeFormatter m_Extra = nullptr;
+		std::uint32_t m_Size      = 0; // bytes of node data the fields and m_Extra read, what a capture stores
+	};
+
+	constexpr std::size_t GetSyncFieldSize(SyncFieldType type)
+	{
+		switch (type)
+		{
+		case SyncFieldType::BOOL:
+		case SyncFieldType::INT8:
+		case SyncFieldType::UINT8: return 1;
+		case SyncFieldType::INT16:
+		case SyncFieldType::UINT16: return 2;
+		case SyncFieldType::INT32:
+		case SyncFieldType::UINT32:
+		case SyncFieldType::FLOAT: return 4;
+		case SyncFieldType::INT64:
+		case SyncFieldType::UINT64: return 8;
+		case SyncFieldType::VEC3: return 12;
+		case SyncFieldType::VEC4: return 16;
+		}
+		return 0;
+	}
+
+	template<typename T>
+	consteval SyncFieldType GetSyncFieldType()
+	{
+		if constexpr (std::is_enum_v<T>)
+			return GetSyncFieldType<std::underlying_type_t<T>>();
+		else if constexpr (std::is_same_v<T, bool>)
+			return SyncFieldType::BOOL;
+		else if constexpr (std::is_integral_v<T>)
+		{
+			constexpr auto index = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+			constexpr SyncFieldType signedTypes[]   = {SyncFieldType::INT8, SyncFieldType::INT16, SyncFieldType::INT32, SyncFieldType::INT64};
+			constexpr SyncFieldType unsignedTypes[] = {SyncFieldType::UINT8, SyncFieldType::UINT16, SyncFieldType::UINT32, SyncFieldType::UINT64};
+			return std::is_signed_v<T> ? signedTypes[index] : unsignedTypes[index];
+		}
+		else if constexpr (std::is_same_v<T, float>)
+			return SyncFieldType::FLOAT;
+		else if constexpr (requires(T v) { v.w; } && sizeof(T) == 16)
+			return SyncFieldType::VEC4;
+		else if constexpr (requires(T v) { v.z; } && sizeof(T) >= 12)
+			return SyncFieldType::VEC3;
+		else
+			static_assert(sizeof(T) == 0, "unsupported sync field type");
+	}
+
+	/**
+	 * @brief Bytes of node data read by the fields
+	 */
+	constexpr std::uint32_t GetSyncFieldsExtent(std::span<const SyncField> fields)
+	{
+		std::uint32_t extent = 0;
+		for (const auto& field : fields)
+		{
+			const auto end = field.m_Offset + (field.m_Count - 1) * field.m_Stride + GetSyncFieldSize(field.m_Type);
+			extent         = end > extent ? static_cast<std::uint32_t>(end) : extent;
+		}
+		return extent;
+	}
+
+	/**
+	 * @brief Formats sync node data from a table of field descriptors, or captures it raw to format later
+	 *
+	 * A whole node becomes a single string, one log line instead of one per field. The capture keeps the most
+	 * recent few MiB of raw node data in memory, which costs a copy per node instead of any formatting.
+	 */
+	class SyncNodeDumper
+	{
+	public:
+		struct CaptureHeader
+		{
+			std::int64_t m_Time; // system clock, nanoseconds since the epoch
+			std::uint32_t m_Node;
+			std::int32_t m_ObjectId; // -1 without an object
+			std::uint32_t m_Size;    // bytes of node data following the header
+			std::uint8_t m_ObjectType;
+			std::uint8_t m_Player; // 0xFF if unknown
+			std::uint16_t m_Flags;
+		};
+
+		static constexpr std::uint32_t g_CaptureOutgoing = 1 << 0;
+
+		/**
+		 * @brief Appends "\n\tname: value" for every field of the layout
+		 */
+		static void Format(std::string& out, const SyncNodeLayout& layout, const std::uint8_t* data);
+
+		/**
+		 * @brief Appends a single field, m_Name is replaced by name and m_Offset is relative to data
+		 */
+		static void AppendField(std::string& out, std::string_view name, const SyncField& field, const std::uint8_t* data);
+
+		template<typename T>
+		static void AppendValue(std::string& out, std::string_view name, const T& value, SyncFieldFormat format = SyncFieldFormat::DEFAULT)
+		{
+			AppendField(out, name, {nullptr, 0, GetSyncFieldType<T>(), format}, reinterpret_cast<const std::uint8_t*>(&value));
+		}
+
+		static void Capture(const CaptureHeader& header, const std::uint8_t* data);
+		static void ClearCapture();
+
+		/**
+		 * @brief Copies the captured nodes, oldest first
+		 */
+		static std::vector<std::uint8_t> GetCapture();
+
+		/**
+		 * @brief Calls func(header, data) for every node in a buffer returned by GetCapture()
+		 */
+		template<typename F>
+		static void ForEachCaptured(std::span<const std::uint8_t> capture, F&& func)
+		{
+			std::size_t offset = 0;
+			while (offset + sizeof(CaptureHeader) <= capture.size())
+			{
+				CaptureHeader header;
+				std::memcpy(&header, capture.data() + offset, sizeof(header));
+				offset += sizeof(header);
+				if (offset + header.m_Size > capture.size())
+					break;
+
+				func(header, capture.data() + offset);
+				offset += header.m_Size;
+			}
+		}
+
+	private:
+		static constexpr std::size_t g_CaptureBufferSize = 4 * 1024 * 1024; // two of these hold the capture
+
+		static SyncNodeDumper& GetInstance()
+		{
+			static SyncNodeDumper i{};
+			return i;
+		}
+
+		std::mutex m_CaptureMutex;
+		std::vector<std::uint8_t> m_Capture;
+		std::vector<std::uint8_t> m_PreviousCapture;
+	};
+}
+
+#define SYNC_FIELD_OF(type, field, format) \
+	::YimMenu::SyncField{#field, static_cast<std::uint32_t>(offsetof(type, field)), ::YimMenu::GetSyncFieldType<std::remove_cvref_t<decltype(std::declval<type&>().field)>>(), format}
+#define SYNC_FIELD(type, field) SYNC_FIELD_OF(type, field, ::YimMenu::SyncFieldFormat::DEFAULT)
+#define SYNC_FIELD_H(type, field) SYNC_FIELD_OF(type, field, ::YimMenu::SyncFieldFormat::HEX)
+
+// fields we only know the offset and size of
+#define SYNC_FIELD_AT(offset, type) ::YimMenu::SyncField{"FIELD_" #offset, offset, ::YimMenu::GetSyncFieldType<type>()}
+#define SYNC_FIELD_ARRAY_AT(offset, type, count, stride) \
+	::YimMenu::SyncField{"FIELD_" #offset, offset, ::YimMenu::GetSyncFieldType<type>(), ::YimMenu::SyncFieldFormat::DEFAULT, count, stride}
@@ -259,6 +259,7 @@ namespace YimMenu
 			{
 				*Pointers.ExplosionBypass = true;
 				Commands::RunLoopedCommands();
+				LogLimiter::Flush();
 				if (GetForegroundWindow() == *Pointers.Hwnd && !HUD::IS_PAUSE_MENU_ACTIVE() && !GUI::IsOpen())
 					g_HotkeySystem.Update();
 				Self::Update();
@@ -21,5 +21,5 @@ namespace YimMenu::Features
 		}
 	};
 
-	static KeepHorseAgitationLow _KeepHorseAgitationLow{"keephorseagitationlow", "Keep Horse Agitation Low", "Keeps your horse from getting agitated"};
+	static KeepHorseAgitationLow _KeepHorseAgitationLow{"keephorseagitationlow", "Keep Horse Agitation Low", "Keeps your horse from getting agitated", 250ms};
 }
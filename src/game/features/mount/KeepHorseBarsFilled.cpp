@@ -24,5 +24,5 @@ namespace YimMenu::Features
 		}
 	};
 
-	static KeepHorseBarsFilled _KeepHorseBarsFilled{"keephorsebarsfilled", "Keep Horse Bars Filled", "Keeps your horse's Health and Stamina filled"};
+	static KeepHorseBarsFilled _KeepHorseBarsFilled{"keephorsebarsfilled", "Keep Horse Bars Filled", "Keeps your horse's Health and Stamina filled", 250ms};
 }
@@ -22,5 +22,5 @@ namespace YimMenu::Features
 		}
 	};
 
-	static KeepHorseClean _KeepHorseClean{"keephorseclean", "Keep Horse Clean", "Keeps your horse from being dirty"};
+	static KeepHorseClean _KeepHorseClean{"keephorseclean", "Keep Horse Clean", "Keeps your horse from being dirty", 500ms};
 }
\ No newline at end of file
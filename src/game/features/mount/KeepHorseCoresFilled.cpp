@@ -25,5 +25,5 @@ namespace YimMenu::Features
 		}
 	};
 
-	static KeepHorseCoresFilled _KeepHorseCoresFilled{"keephorsecoresfilled", "Keep Horse Cores Filled", "Keeps your horse's Health, Stamina and Deadeye cores filled"};
+	static KeepHorseCoresFilled _KeepHorseCoresFilled{"keephorsecoresfilled", "Keep Horse Cores Filled", "Keeps your horse's Health, Stamina and Deadeye cores filled", 1s};
 }
\ No newline at end of file
@@ -26,5 +26,5 @@ namespace YimMenu::Features
 		}
 	};
 
-	static AntiAfk _AntiAfk{"antiafk", "Anti Afk", "Prevents you from being idle kicked"};
+	static AntiAfk _AntiAfk{"antiafk", "Anti Afk", "Prevents you from being idle kicked", 5s};
 }
\ No newline at end of file
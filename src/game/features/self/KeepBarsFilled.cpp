@@ -35,5 +35,5 @@ namespace YimMenu::Features
 		}
 	};
 
-	static KeepBarsFilled _KeepBarsFilled{"keepbarsfilled", "Keep Bars Filled", "Keeps your Health, Stamina and Deadeye filled"};
+	static KeepBarsFilled _KeepBarsFilled{"keepbarsfilled", "Keep Bars Filled", "Keeps your Health, Stamina and Deadeye filled", 250ms};
 }
\ No newline at end of file
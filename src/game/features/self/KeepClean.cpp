@@ -22,5 +22,5 @@ namespace YimMenu::Features
 		}
 	};
 
-	static KeepClean _KeepClean{"keepclean", "Keep Clean", "Keeps your character from being dirty"};
+	static KeepClean _KeepClean{"keepclean", "Keep Clean", "Keeps your character from being dirty", 500ms};
 }
\ No newline at end of file
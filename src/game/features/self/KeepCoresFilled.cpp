@@ -32,5 +32,5 @@ namespace YimMenu::Features
 		}
 	};
 
-	static KeepCoresFilled _KeepCoresFilled{"keepcoresfilled", "Keep Cores Filled", "Keeps your Health, Stamina and Deadeye cores filled"};
+	static KeepCoresFilled _KeepCoresFilled{"keepcoresfilled", "Keep Cores Filled", "Keeps your Health, Stamina and Deadeye cores filled", 1s};
 }
\ No newline at end of file
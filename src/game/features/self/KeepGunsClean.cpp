@@ -22,5 +22,5 @@ namespace YimMenu::Features
 		}
 	};
 
-	static KeepGunsClean _KeepGunsClean{"keepgunsclean", "Keep Guns Clean", "Keeps your Guns in Pristine condition"};
+	static KeepGunsClean _KeepGunsClean{"keepgunsclean", "Keep Guns Clean", "Keeps your Guns in Pristine condition", 500ms};
 }
\ No newline at end of file
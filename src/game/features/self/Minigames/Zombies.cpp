@@ -30,22 +30,16 @@ namespace YimMenu::Features
 
 	static void CleanupZombiesIndex()
 	{
-		auto it = zombie_index.begin();
-		while (it != zombie_index.end())
-		{
-			if (!ENTITY::DOES_ENTITY_EXIST(*it) || ENTITY::IS_ENTITY_DEAD(*it))
-			{
-				if (!ENTITY::IS_ENTITY_DEAD(*it))
-				{
-					zombie_index.push_back(*it);
-				}
-				it = zombie_index.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
+		std::erase_if(zombie_index, [](int zombie) {
+			if (!ENTITY::DOES_ENTITY_EXIST(zombie))
+				return true;
+			if (!ENTITY::IS_ENTITY_DEAD(zombie))
+				return false;
+
+			// the bodies are deleted once there are too many of them
+			dead_zombies_index.push_back(zombie);
+			return true;
+		});
 	}
 
 	static void CleanupDeadZombiesIndex()
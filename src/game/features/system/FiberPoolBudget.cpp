@@ -0,0 +1,23 @@
+#include "core/commands/IntCommand.hpp"
+#include "game/backend/FiberPool.hpp"
+
+namespace YimMenu::Features
+{
+	class FiberPoolBudget : public IntCommand
+	{
+		using IntCommand::IntCommand;
+
+		virtual void OnChange() override
+		{
+			FiberPool::SetTickBudget(std::chrono::microseconds(GetState()));
+		}
+
+		virtual void LoadState(nlohmann::json& value) override
+		{
+			IntCommand::LoadState(value);
+			OnChange();
+		}
+	};
+
+	static FiberPoolBudget _FiberPoolBudget("fiberpoolbudget", "Fiber Pool Budget (us)", "Time the queued menu actions may take up per game tick, higher values drain bursts faster at the cost of frame time", 250, 16000, 2000);
+}
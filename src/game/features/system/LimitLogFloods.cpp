@@ -0,0 +1,22 @@
+#include "core/commands/BoolCommand.hpp"
+#include "core/logger/LogLimiter.hpp"
+
+namespace YimMenu::Features
+{
+	class LimitLogFloods : public BoolCommand
+	{
+		using BoolCommand::BoolCommand;
+
+		virtual void OnEnable() override
+		{
+			LogLimiter::SetEnabled(true);
+		}
+
+		virtual void OnDisable() override
+		{
+			LogLimiter::SetEnabled(false);
+		}
+	};
+
+	static LimitLogFloods _LimitLogFloods("limitlogfloods", "Limit Log Floods", "Drops repeated log lines from the same place once they exceed a few per second and logs how many were suppressed", true);
+}
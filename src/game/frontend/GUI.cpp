@@ -4,6 +4,7 @@
 #include "ContextMenu.hpp"
 #include "Overlay.hpp"
 #include "core/renderer/Renderer.hpp"
+#include "core/misc/Tracer.hpp"
 #include "core/frontend/Notifications.hpp"
 #include "game/frontend/ChatDisplay.hpp"
 
@@ -12,6 +13,8 @@ namespace YimMenu
 	GUI::GUI() :
 	    m_IsOpen(false)
 	{
+		TRACE_SCOPE("GUI::Init");
+
 		Menu::SetupFonts();
 		Menu::SetupStyle();
 		Menu::Init();
@@ -52,11 +52,13 @@ namespace YimMenu
 						    FiberPool::Push([] {
 							    Commands::Shutdown();
 							    g_Running = false;
+							    g_Running.notify_all();
 						    });
 					    }
 					    else
 					    {
 						    g_Running = false;
+						    g_Running.notify_all();
 					    }
 				    }
 				    //ImGui::EndDisabled();
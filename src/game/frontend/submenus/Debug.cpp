@@ -2,14 +2,19 @@
 
 #include "Debug/Globals.hpp"
 #include "Debug/Locals.hpp"
+#include "Debug/Profiler.hpp"
 #include "Debug/Scripts.hpp"
 #include "core/commands/BoolCommand.hpp"
 #include "core/filemgr/FileMgr.hpp"
+#include "core/frontend/Notifications.hpp"
+#include "core/misc/Tracer.hpp"
 #include "game/backend/FiberPool.hpp"
 #include "game/backend/NativeHooks.hpp"
+#include "game/backend/SyncNodeDumper.hpp"
 #include "game/frontend/items/Items.hpp"
 #include "game/rdr/Natives.hpp"
 #include "game/rdr/Object.hpp"
+#include "game/rdr/SyncNodeLayouts.hpp"
 #include "game/backend/Self.hpp"
 
 namespace YimMenu::Features
@@ -25,11 +30,13 @@ namespace YimMenu::Submenus
 		AddCategory(BuildGlobalsMenu());
 		AddCategory(BuildLocalsMenu());
 		AddCategory(BuildScriptsMenu());
+		AddCategory(BuildProfilerMenu());
 
 		auto debug = std::make_shared<Category>("Logging/Misc");
 
 		debug->AddItem(std::make_shared<BoolCommandItem>("logclones"_J));
 		debug->AddItem(std::make_shared<BoolCommandItem>("logoutgoingclones"_J));
+		debug->AddItem(std::make_shared<BoolCommandItem>("captureclones"_J));
 		debug->AddItem(std::make_shared<BoolCommandItem>("logevents"_J));
 		debug->AddItem(std::make_shared<BoolCommandItem>("logtses"_J));
 		debug->AddItem(std::make_shared<BoolCommandItem>("logmetrics"_J));
@@ -41,12 +48,34 @@ namespace YimMenu::Submenus
 		debug->AddItem(std::make_shared<BoolCommandItem>("logpresenceevents"_J));
 		debug->AddItem(std::make_shared<BoolCommandItem>("logpostmessage"_J));
 		debug->AddItem(std::make_shared<BoolCommandItem>("logservermessages"_J));
+		debug->AddItem(std::make_shared<BoolCommandItem>("limitlogfloods"_J));
 		//debug->AddItem(std::make_shared<BoolCommandItem>("logscriptlaunches"_J));
 
 		debug->AddItem(std::make_shared<BoolCommandItem>("betterentitycheck"_J));
 		debug->AddItem(std::make_shared<CommandItem>("chathelper"_J));
 		debug->AddItem(std::make_shared<CommandItem>("clearchat"_J));
 		debug->AddItem(std::make_shared<ImGuiItem>([] {
+#ifdef TERMINUS_TRACING
+			if (ImGui::Button("Dump Trace"))
+			{
+				if (Tracer::Dump(FileMgr::GetProjectFile("./trace.json").Path()))
+					Notifications::Show("Debug", "Trace written to trace.json, open it in ui.perfetto.dev", NotificationType::Success);
+				else
+					Notifications::Show("Debug", "Failed to write trace.json", NotificationType::Error);
+			}
+#endif
+
+			if (ImGui::Button("Export Clone Capture"))
+			{
+				if (SyncNodeLayouts::ExportCapture(FileMgr::GetProjectFile("./clone_capture.txt").Path()))
+					Notifications::Show("Debug", "Clone capture written to clone_capture.txt", NotificationType::Success);
+				else
+					Notifications::Show("Debug", "Failed to write clone_capture.txt", NotificationType::Error);
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Clear Clone Capture"))
+				SyncNodeDumper::ClearCapture();
+
 			if (ImGui::Button("Bail to Loading Screen"))
 			{
 				FiberPool::Push([] {
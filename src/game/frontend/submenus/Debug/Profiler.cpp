@@ -0,0 +1,148 @@
+#include "Profiler.hpp"
+#include "core/filemgr/FileMgr.hpp"
+#include "core/frontend/Notifications.hpp"
+#include "core/misc/TickProfiler.hpp"
+#include "core/misc/WorkerPool.hpp"
+#include "game/backend/FiberPool.hpp"
+
+namespace YimMenu::Submenus
+{
+	enum class ProfilerColumn
+	{
+		NAME,
+		CATEGORY,
+		CALLS,
+		TOTAL,
+		AVERAGE,
+		MAX,
+		P99
+	};
+
+	static void SortStats(std::vector<TickProfiler::Stats>& stats, const ImGuiTableColumnSortSpecs& spec)
+	{
+		const auto descending = spec.SortDirection == ImGuiSortDirection_Descending;
+		const auto sort       = [&](auto projection) {
+			std::ranges::sort(stats, [&](const TickProfiler::Stats& a, const TickProfiler::Stats& b) {
+				return descending ? projection(b) < projection(a) : projection(a) < projection(b);
+			});
+		};
+
+		switch (static_cast<ProfilerColumn>(spec.ColumnUserID))
+		{
+		case ProfilerColumn::NAME: sort([](const TickProfiler::Stats& s) { return std::string_view(s.m_Name); }); break;
+		case ProfilerColumn::CATEGORY: sort([](const TickProfiler::Stats& s) { return s.m_Category; }); break;
+		case ProfilerColumn::CALLS: sort([](const TickProfiler::Stats& s) { return s.m_Calls; }); break;
+		case ProfilerColumn::TOTAL: sort([](const TickProfiler::Stats& s) { return s.m_TotalMs; }); break;
+		case ProfilerColumn::AVERAGE: sort([](const TickProfiler::Stats& s) { return s.AverageMs(); }); break;
+		case ProfilerColumn::MAX: sort([](const TickProfiler::Stats& s) { return s.m_MaxMs; }); break;
+		case ProfilerColumn::P99: sort([](const TickProfiler::Stats& s) { return s.m_P99Ms; }); break;
+		}
+	}
+
+	std::shared_ptr<Category> BuildProfilerMenu()
+	{
+		auto profiler = std::make_unique<Category>("Profiler");
+
+		profiler->AddItem(std::make_unique<IntCommandItem>("fiberpoolbudget"_J));
+
+		profiler->AddItem(std::make_unique<ImGuiItem>([] {
+			static std::vector<TickProfiler::Stats> stats;
+			static std::chrono::steady_clock::time_point lastUpdate{};
+			static ImGuiTableColumnSortSpecs sortSpec{};
+			bool resort = false;
+
+			if (ImGui::Button("Reset"))
+			{
+				TickProfiler::Reset();
+				FiberPool::ResetPeaks();
+				lastUpdate = {};
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Export"))
+			{
+				if (TickProfiler::Dump(FileMgr::GetProjectFile("./profiler.json").Path()))
+					Notifications::Show("Profiler", "Statistics written to profiler.json", NotificationType::Success);
+				else
+					Notifications::Show("Profiler", "Failed to write profiler.json", NotificationType::Error);
+			}
+
+			// a few updates per second keep the numbers readable
+			if (std::chrono::steady_clock::now() - lastUpdate > 250ms)
+			{
+				stats      = TickProfiler::GetStats();
+				lastUpdate = std::chrono::steady_clock::now();
+				resort     = true;
+			}
+
+			const auto pool = FiberPool::GetStats();
+			ImGui::Text("Fiber pool: %u interactive, %u background waiting (max %u), %llu run, wait avg %.2f ms max %.2f ms, %llu overflowed",
+			    pool.m_Depth[static_cast<std::size_t>(JobPriority::INTERACTIVE)],
+			    pool.m_Depth[static_cast<std::size_t>(JobPriority::BACKGROUND)],
+			    pool.m_MaxDepth,
+			    pool.m_Run,
+			    pool.m_AverageWaitMs,
+			    pool.m_MaxWaitMs,
+			    pool.m_Overflowed);
+
+			const auto workers = WorkerPool::GetStats();
+			ImGui::Text("Worker pool: %zu queued, %zu completions waiting, %llu done, %llu failed, %llu stalls, %llu file writes (%llu coalesced)",
+			    workers.m_Queued,
+			    workers.m_PendingCompletions,
+			    workers.m_Completed,
+			    workers.m_Failed,
+			    workers.m_Stalls,
+			    workers.m_FileWrites,
+			    workers.m_Coalesced);
+
+			constexpr auto flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingStretchProp;
+			if (!ImGui::BeginTable("##profiler", 7, flags, ImVec2(0, 400)))
+				return;
+
+			ImGui::TableSetupScrollFreeze(0, 1);
+			ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 3.0f, static_cast<ImGuiID>(ProfilerColumn::NAME));
+			ImGui::TableSetupColumn("Kind", 0, 1.0f, static_cast<ImGuiID>(ProfilerColumn::CATEGORY));
+			ImGui::TableSetupColumn("Calls", 0, 1.0f, static_cast<ImGuiID>(ProfilerColumn::CALLS));
+			ImGui::TableSetupColumn("Total ms", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending, 1.0f, static_cast<ImGuiID>(ProfilerColumn::TOTAL));
+			ImGui::TableSetupColumn("Avg ms", ImGuiTableColumnFlags_PreferSortDescending, 1.0f, static_cast<ImGuiID>(ProfilerColumn::AVERAGE));
+			ImGui::TableSetupColumn("Max ms", ImGuiTableColumnFlags_PreferSortDescending, 1.0f, static_cast<ImGuiID>(ProfilerColumn::MAX));
+			ImGui::TableSetupColumn("p99 ms", ImGuiTableColumnFlags_PreferSortDescending, 1.0f, static_cast<ImGuiID>(ProfilerColumn::P99));
+			ImGui::TableHeadersRow();
+
+			if (auto specs = ImGui::TableGetSortSpecs(); specs && specs->SpecsCount > 0)
+			{
+				if (specs->SpecsDirty)
+				{
+					sortSpec          = specs->Specs[0];
+					specs->SpecsDirty = false;
+					resort            = true;
+				}
+			}
+
+			if (resort)
+				SortStats(stats, sortSpec);
+
+			for (const auto& entry : stats)
+			{
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(entry.m_Name.c_str());
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(entry.m_Category.data(), entry.m_Category.data() + entry.m_Category.size());
+				ImGui::TableNextColumn();
+				ImGui::Text("%llu", entry.m_Calls);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2f", entry.m_TotalMs);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.4f", entry.AverageMs());
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", entry.m_MaxMs);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", entry.m_P99Ms);
+			}
+
+			ImGui::EndTable();
+		}));
+
+		return profiler;
+	}
+}
@@ -15,6 +15,7 @@
 #include "game/rdr/Enums.hpp"
 #include "game/rdr/Natives.hpp"
 #include "game/rdr/Pools.hpp"
+#include "game/rdr/Streaming.hpp"
 #include "game/rdr/data/PedModels.hpp"
 
 #include <algorithm>
@@ -460,46 +461,44 @@ namespace YimMenu::Submenus
 	static void SetHorseGender(Ped horse, int gender);
 
 	// function to set player model (based on existing "Set Model" button logic)
-	static void SetPlayerModel(const std::string& model, int variation = 0, bool isHorse = false)
+	static Task<> SetPlayerModelTask(std::string model, int variation, bool isHorse)
 	{
-		FiberPool::Push([model, variation, isHorse] {
-			auto modelHash = Joaat(model);
+		auto modelHash = Joaat(model);
+		co_await ModelLoaded(modelHash);
 
-			for (int i = 0; i < 30 && !STREAMING::HAS_MODEL_LOADED(modelHash); i++)
-			{
-				STREAMING::REQUEST_MODEL(modelHash, false);
-				ScriptMgr::Yield();
-			}
+		PLAYER::SET_PLAYER_MODEL(Self::GetPlayer().GetId(), modelHash, false);
+		Self::Update();
 
-			PLAYER::SET_PLAYER_MODEL(Self::GetPlayer().GetId(), modelHash, false);
-			Self::Update();
+		if (variation > 0)
+			Self::GetPed().SetVariation(variation);
+		else
+			PED::_SET_RANDOM_OUTFIT_VARIATION(Self::GetPed().GetHandle(), true);
 
-			if (variation > 0)
-				Self::GetPed().SetVariation(variation);
-			else
-				PED::_SET_RANDOM_OUTFIT_VARIATION(Self::GetPed().GetHandle(), true);
+		// track model and variation for automatic session fix
+		Hooks::Info::UpdateStoredPlayerModel(modelHash, variation);
 
-			// track model and variation for automatic session fix
-			Hooks::Info::UpdateStoredPlayerModel(modelHash, variation);
+		// apply horse gender if this is a horse (after variation is set)
+		if (isHorse)
+		{
+			SetHorseGender(Self::GetPed(), g_HorseGender);
+		}
 
-			// apply horse gender if this is a horse (after variation is set)
-			if (isHorse)
-			{
-				SetHorseGender(Self::GetPed(), g_HorseGender);
-			}
+		// give weapon if armed is enabled and ped is not an animal
+		if (g_Armed && !Self::GetPed().IsAnimal())
+		{
+			auto weapon = GetDefaultWeaponForPed(model);
+			WEAPON::GIVE_WEAPON_TO_PED(Self::GetPed().GetHandle(), Joaat(weapon), 100, true, false, 0, true, 0.5f, 1.0f, 0x2CD419DC, true, 0.0f, false);
+			WEAPON::SET_PED_INFINITE_AMMO(Self::GetPed().GetHandle(), true, Joaat(weapon));
+			co_await NextTick();
+			WEAPON::SET_CURRENT_PED_WEAPON(Self::GetPed().GetHandle(), "WEAPON_UNARMED"_J, true, 0, false, false);
+		}
 
-			// give weapon if armed is enabled and ped is not an animal
-			if (g_Armed && !Self::GetPed().IsAnimal())
-			{
-				auto weapon = GetDefaultWeaponForPed(model);
-				WEAPON::GIVE_WEAPON_TO_PED(Self::GetPed().GetHandle(), Joaat(weapon), 100, true, false, 0, true, 0.5f, 1.0f, 0x2CD419DC, true, 0.0f, false);
-				WEAPON::SET_PED_INFINITE_AMMO(Self::GetPed().GetHandle(), true, Joaat(weapon));
-				ScriptMgr::Yield();
-				WEAPON::SET_CURRENT_PED_WEAPON(Self::GetPed().GetHandle(), "WEAPON_UNARMED"_J, true, 0, false, false);
-			}
+		STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(modelHash);
+	}
 
-			STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(modelHash);
-		});
+	static void SetPlayerModel(const std::string& model, int variation = 0, bool isHorse = false)
+	{
+		ScriptMgr::Spawn(SetPlayerModelTask(model, variation, isHorse));
 	}
 
 	// function to set horse gender using discovered community natives
@@ -5550,38 +5549,7 @@ namespace YimMenu::Submenus
 		ImGui::SameLine();
 		if (ImGui::Button("Set Model"))
 		{
-			FiberPool::Push([] {
-				auto model = Joaat(g_PedModelBuffer);
-
-				for (int i = 0; i < 30 && !STREAMING::HAS_MODEL_LOADED(model); i++)
-				{
-					STREAMING::REQUEST_MODEL(model, false);
-					ScriptMgr::Yield();
-				}
-
-				PLAYER::SET_PLAYER_MODEL(Self::GetPlayer().GetId(), model, false);
-				Self::Update();
-
-				if (g_Variation > 0)
-					Self::GetPed().SetVariation(g_Variation);
-				else
-					PED::_SET_RANDOM_OUTFIT_VARIATION(Self::GetPed().GetHandle(), true);
-
-				// track model and variation for automatic session fix
-				Hooks::Info::UpdateStoredPlayerModel(model, g_Variation);
-
-				// give weapon if armed is enabled and ped is not an animal
-				if (g_Armed && !Self::GetPed().IsAnimal())
-				{
-					auto weapon = GetDefaultWeaponForPed(g_PedModelBuffer);
-					WEAPON::GIVE_WEAPON_TO_PED(Self::GetPed().GetHandle(), Joaat(weapon), 100, true, false, 0, true, 0.5f, 1.0f, 0x2CD419DC, true, 0.0f, false);
-					WEAPON::SET_PED_INFINITE_AMMO(Self::GetPed().GetHandle(), true, Joaat(weapon));
-					ScriptMgr::Yield();
-					WEAPON::SET_CURRENT_PED_WEAPON(Self::GetPed().GetHandle(), "WEAPON_UNARMED"_J, true, 0, false, false);
-				}
-
-				STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
-			});
+			SetPlayerModel(g_PedModelBuffer, g_Variation);
 		}
 		ImGui::SameLine();
 		if (ImGui::Button("Story Gang"))
@@ -9,6 +9,7 @@
 #include "game/frontend/items/Items.hpp"
 #include "game/rdr/Enums.hpp"
 #include "game/rdr/Natives.hpp"
+#include "game/rdr/Streaming.hpp"
 #include "game/rdr/data/PedModels.hpp"
 
 
@@ -78,6 +79,32 @@ namespace YimMenu::Submenus
 		return 0;
 	}
 
+	static Task<> SetModelTask(std::string modelName, int variation, bool armed)
+	{
+		auto model = Joaat(modelName);
+		co_await ModelLoaded(model);
+
+		PLAYER::SET_PLAYER_MODEL(Self::GetPlayer().GetId(), model, false);
+		Self::Update();
+
+		if (variation > 0)
+			Self::GetPed().SetVariation(variation);
+		else
+			PED::_SET_RANDOM_OUTFIT_VARIATION(Self::GetPed().GetHandle(), true);
+
+		// give weapon if armed is enabled and ped is not an animal
+		if (armed && !Self::GetPed().IsAnimal())
+		{
+			auto weapon = GetDefaultWeaponForPed(modelName);
+			WEAPON::GIVE_WEAPON_TO_PED(Self::GetPed().GetHandle(), Joaat(weapon), 100, true, false, 0, true, 0.5f, 1.0f, 0x2CD419DC, true, 0.0f, false);
+			WEAPON::SET_PED_INFINITE_AMMO(Self::GetPed().GetHandle(), true, Joaat(weapon));
+			co_await NextTick();
+			WEAPON::SET_CURRENT_PED_WEAPON(Self::GetPed().GetHandle(), "WEAPON_UNARMED"_J, true, 0, false, false);
+		}
+
+		STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
+	}
+
 	void RenderPedSpawnerMenu()
 	{
 		ImGui::PushID("peds"_J);
@@ -258,35 +285,7 @@ namespace YimMenu::Submenus
 		ImGui::SameLine();
 		if (ImGui::Button("Set Model"))
 		{
-			FiberPool::Push([] {
-				auto model = Joaat(pedModelBuffer);
-
-				for (int i = 0; i < 30 && !STREAMING::HAS_MODEL_LOADED(model); i++)
-				{
-					STREAMING::REQUEST_MODEL(model, false);
-					ScriptMgr::Yield();
-				}
-
-				PLAYER::SET_PLAYER_MODEL(Self::GetPlayer().GetId(), model, false);
-				Self::Update();
-
-				if (variation > 0)
-					Self::GetPed().SetVariation(variation);
-				else
-					PED::_SET_RANDOM_OUTFIT_VARIATION(Self::GetPed().GetHandle(), true);
-
-				// give weapon if armed is enabled and ped is not an animal
-				if (armed && !Self::GetPed().IsAnimal())
-				{
-					auto weapon = GetDefaultWeaponForPed(pedModelBuffer);
-					WEAPON::GIVE_WEAPON_TO_PED(Self::GetPed().GetHandle(), Joaat(weapon), 100, true, false, 0, true, 0.5f, 1.0f, 0x2CD419DC, true, 0.0f, false);
-					WEAPON::SET_PED_INFINITE_AMMO(Self::GetPed().GetHandle(), true, Joaat(weapon));
-					ScriptMgr::Yield();
-					WEAPON::SET_CURRENT_PED_WEAPON(Self::GetPed().GetHandle(), "WEAPON_UNARMED"_J, true, 0, false, false);
-				}
-
-				STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
-			});
+			ScriptMgr::Spawn(SetModelTask(pedModelBuffer, variation, armed));
 		}
 		ImGui::SameLine();
 		if (ImGui::Button("Story Gang"))
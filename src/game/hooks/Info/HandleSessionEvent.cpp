@@ -98,7 +98,7 @@ namespace YimMenu::Hooks
 				{
 					FiberPool::Push([] {
 						PerformSyncRepair();
-					});
+					}, JobPriority::BACKGROUND);
 				}
 			}
 
@@ -217,7 +217,7 @@ namespace YimMenu::Hooks
 
 					// perform the exact same steps you do manually
 					PerformAutomaticModelFix();
-				});
+				}, JobPriority::BACKGROUND);
 			}
 			else if (!g_InSession)
 			{
@@ -1,4 +1,5 @@
 #include "core/hooking/DetourHook.hpp"
+#include "core/misc/FlightRecorder.hpp"
 #include "core/frontend/Notifications.hpp"
 #include "game/backend/Protections.hpp"
 #include "game/backend/Self.hpp"
@@ -12,6 +13,8 @@ namespace YimMenu::Hooks
 {
 	int Protections::HandleCloneSync(void* mgr, CNetGamePlayer* src, CNetGamePlayer* dst, uint16_t objectType, uint16_t objectId, rage::datBitBuffer* buffer, int a7, int a8, void* a9)
 	{
+		FlightRecorder::Record(FlightEvent::CLONE_SYNC, objectType, objectId, src ? src->m_PlayerIndex : g_FlightNoPlayer);
+
 		if (Self::GetPed() && Self::GetPed().GetNetworkObjectId() == objectId)
 		{
 			Notifications::Show("Protections", std::format("Blocked player sync crash from {}", src->GetName()), NotificationType::Warning);
@@ -1,5 +1,6 @@
 #include "core/commands/BoolCommand.hpp"
 #include "core/hooking/DetourHook.hpp"
+#include "core/misc/FlightRecorder.hpp"
 #include "game/backend/PlayerData.hpp"
 #include "game/backend/Protections.hpp"
 #include "game/backend/Self.hpp"
@@ -94,10 +95,11 @@ namespace YimMenu::Hooks
 	void Protections::HandleNetGameEvent(rage::netEventMgr* eventMgr, CNetGamePlayer* sourcePlayer, CNetGamePlayer* targetPlayer, NetEventType type, int index, int handledBits, std::int16_t unk, rage::datBitBuffer* buffer)
 	{
 		rage::datBitBuffer new_buffer = *buffer;
+		FlightRecorder::Record(FlightEvent::NET_EVENT, static_cast<std::uint64_t>(type), sourcePlayer ? sourcePlayer->m_PlayerIndex : g_FlightNoPlayer, targetPlayer ? targetPlayer->m_PlayerIndex : g_FlightNoPlayer);
 
 		if (Features::_LogEvents.GetState() && (int)type < g_NetEventsToString.size())
 		{
-			LOG(INFO) << "NETWORK_EVENT: " << g_NetEventsToString[(int)type] << " from " << sourcePlayer->GetName();
+			LOG_LIMITED(INFO) << "NETWORK_EVENT: " << g_NetEventsToString[(int)type] << " from " << sourcePlayer->GetName();
 		}
 
 		if (type == NetEventType::NETWORK_DESTROY_VEHICLE_LOCK_EVENT)
@@ -107,7 +109,7 @@ namespace YimMenu::Hooks
 			{
 				if (!IsVehicleType((NetObjType)object->m_ObjectType))
 				{
-					LOG(WARNING) << "Blocked mismatched destroy vehicle lock event entity from " << sourcePlayer->GetName();
+					LOG_LIMITED(WARNING) << "Blocked mismatched destroy vehicle lock event entity from " << sourcePlayer->GetName();
 					Player(sourcePlayer).AddDetection(Detection::TRIED_CRASH_PLAYER);
 					Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
 					return;
@@ -120,7 +122,7 @@ namespace YimMenu::Hooks
 			if (Features::_BlockExplosions.GetState()
 			    || (Player(sourcePlayer).IsValid() && Player(sourcePlayer).GetData().m_BlockExplosions))
 			{
-				LOG(WARNING) << "Blocked explosion from " << sourcePlayer->GetName();
+				LOG_LIMITED(WARNING) << "Blocked explosion from " << sourcePlayer->GetName();
 				Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
 				return;
 			}
@@ -130,7 +132,7 @@ namespace YimMenu::Hooks
 		{
 			if (Features::_BlockPtfx.GetState() || (Player(sourcePlayer).IsValid() && Player(sourcePlayer).GetData().m_BlockParticles))
 			{
-				LOG(WARNING) << "Blocked particle effects from " << sourcePlayer->GetName();
+				LOG_LIMITED(WARNING) << "Blocked particle effects from " << sourcePlayer->GetName();
 				Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
 				return;
 			}
@@ -141,7 +143,7 @@ namespace YimMenu::Hooks
 			auto net_id = new_buffer.Read<uint16_t>(13);
 			if (net_id == Self::GetPed().GetNetworkObjectId())
 			{
-				LOG(WARNING) << "Blocked clear ped tasks from " << sourcePlayer->GetName();
+				LOG_LIMITED(WARNING) << "Blocked clear ped tasks from " << sourcePlayer->GetName();
 				Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
 				return;
 			}
@@ -149,8 +151,9 @@ namespace YimMenu::Hooks
 
 		if (type == NetEventType::SCRIPT_COMMAND_EVENT && sourcePlayer && Features::_BlockScriptCommand.GetState())
 		{
-			LogScriptCommandEvent(sourcePlayer, new_buffer);
-			LOG(WARNING) << "Blocked remote native call from " << sourcePlayer->GetName();
+			if (LOG_LIMITED_ALLOWED(WARNING))
+				LogScriptCommandEvent(sourcePlayer, new_buffer);
+			LOG_LIMITED(WARNING) << "Blocked remote native call from " << sourcePlayer->GetName();
 			Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
 			Player(sourcePlayer).AddDetection(Detection::MODDER_EVENTS);
 			return;
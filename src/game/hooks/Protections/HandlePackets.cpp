@@ -55,12 +55,12 @@ namespace YimMenu::Hooks
 		if (Features::_LogForwardPackets.GetState() && IsP2pForward(buffer, sizeOfBuffer))
 		{
 			auto packet = (unsigned char*)buffer;
-			LOG(INFO) << "P2P forward packet: " << BytesToHexStr(packet, sizeOfBuffer) << " of size " << sizeOfBuffer;
+			LOG_LIMITED(INFO) << "P2P forward packet: " << BytesToHexStr(packet, sizeOfBuffer) << " of size " << sizeOfBuffer;
 		}
 		else if (Features::_LogTerminusPackets.GetState() && IsP2pTerminus(buffer, sizeOfBuffer))
 		{
 			auto packet = (unsigned char*)buffer;
-			LOG(INFO) << "P2P terminus packet: " << BytesToHexStr(packet, sizeOfBuffer) << " of size " << sizeOfBuffer;
+			LOG_LIMITED(INFO) << "P2P terminus packet: " << BytesToHexStr(packet, sizeOfBuffer) << " of size " << sizeOfBuffer;
 		}
 
 		return ret;
@@ -78,7 +78,7 @@ namespace YimMenu::Hooks
 			              .append("." + std::to_string(sender->m_field4));
 
 			auto packet = (unsigned char*)buffer;
-			LOG(INFO) << "Unpacked Packet: " << BytesToHexStr(packet, sizeOfBuffer) << " Of Size " << sizeOfBuffer << " From: " << ip;
+			LOG_LIMITED(INFO) << "Unpacked Packet: " << BytesToHexStr(packet, sizeOfBuffer) << " Of Size " << sizeOfBuffer << " From: " << ip;
 		}
 	}
 
@@ -23,7 +23,7 @@ namespace YimMenu::Hooks
 
 		if (Features::_LogPresenceEvents.GetState())
 		{
-			LOG(VERBOSE) << "HandlePresenceEvent :: " << payload;
+			LOG_LIMITED(VERBOSE) << "HandlePresenceEvent :: " << payload;
 		}
 
 		BaseHook::Get<Protections::HandlePresenceEvent, DetourHook<decltype(&Protections::HandlePresenceEvent)>>()->Original()(localGamerIndex, data, source);
@@ -53,7 +53,7 @@ namespace YimMenu::Hooks
 
 		uint32_t presence_hash = Joaat(event_payload["e"].get<std::string_view>());
 
-		if (Features::_LogPresenceEvents.GetState())
+		if (Features::_LogPresenceEvents.GetState() && LOG_LIMITED_ALLOWED(VERBOSE))
 		{
 			LOG(VERBOSE) << "Hash of Presence Event: " << std::to_string(presence_hash) << " Sender: " << sender_str << " Channel: " << std::string(channel);
 			LOG(VERBOSE) << "Payload(Raw JSON): " << json.dump();
@@ -71,19 +71,19 @@ namespace YimMenu::Hooks
 		case (uint32_t)PresenceEvents::PRESENCE_TEXT_MESSAGE:
 		{
 			Notifications::Show("Presence Event", std::string("Blocked Text Message from ").append(sender_str), NotificationType::Warning);
-			LOG(WARNING) << "Blocked Text Message from " << sender_str;
+			LOG_LIMITED(WARNING) << "Blocked Text Message from " << sender_str;
 			return true;
 		}
 		case (uint32_t)PresenceEvents::PRESENCE_JOIN_REQUEST:
 		{
 			Notifications::Show("Presence Event", std::string(sender_str).append(" is joining"), NotificationType::Warning);
-			LOG(WARNING) << "Received Join Request from " << sender_str;
+			LOG_LIMITED(WARNING) << "Received Join Request from " << sender_str;
 			break;
 		}
 		case (uint32_t)PresenceEvents::PRESENCE_STAT_UPDATE:
 		{
 			Notifications::Show("Presence Event", std::string("Received Stat Update from ").append(sender_str), NotificationType::Warning);
-			LOG(WARNING) << "Received Stat Update from " << sender_str;
+			LOG_LIMITED(WARNING) << "Received Stat Update from " << sender_str;
 			break;
 		}
 		}
@@ -31,7 +31,7 @@ namespace YimMenu::Hooks
 {
 	bool Protections::HandleScriptedGameEvent(CScriptedGameEvent* event, CNetGamePlayer* src, CNetGamePlayer* dst)
 	{
-		if (Features::_LogScriptEvents.GetState())
+		if (Features::_LogScriptEvents.GetState() && LOG_LIMITED_ALLOWED(VERBOSE))
 		{
 			std::string script_args = "{ ";
 			for (std::size_t i = 0; i < event->m_DataSize / 8; i++)
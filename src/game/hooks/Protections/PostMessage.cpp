@@ -16,7 +16,7 @@ namespace YimMenu::Hooks
 	{
 		if (Features::_LogPostMessage.GetState())
 		{
-			LOG(VERBOSE) << "PostMessage :: " << msg;
+			LOG_LIMITED(VERBOSE) << "PostMessage :: " << msg;
 		}
 
 		return BaseHook::Get<Protections::PPostMessage, DetourHook<decltype(&Protections::PPostMessage)>>()->Original()(localGamerIndex, recipients, numRecipients, msg, ttlSeconds);
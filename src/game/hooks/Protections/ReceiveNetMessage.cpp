@@ -1,6 +1,7 @@
 #include "core/commands/BoolCommand.hpp"
 #include "core/frontend/Notifications.hpp"
 #include "core/hooking/DetourHook.hpp"
+#include "core/misc/FlightRecorder.hpp"
 #include "game/backend/FiberPool.hpp"
 #include "game/backend/PlayerDatabase.hpp"
 #include "game/backend/Players.hpp"
@@ -52,7 +53,7 @@ namespace YimMenu::Hooks
 		GetMessageType(msg_type, buffer);
 
 		static constexpr const auto unloggables = std::to_array({NetMessageType::CLONE_SYNC, NetMessageType::PACKED_CLONE_SYNC_ACKS, NetMessageType::PACKED_EVENTS, NetMessageType::PACKED_RELIABLES, NetMessageType::PACKED_EVENT_RELIABLES_MSGS, NetMessageType::NET_ARRAY_MGR_UPDATE, NetMessageType::NET_ARRAY_MGR_UPDATE_ACK, NetMessageType::NET_ARRAY_MGR_SPLIT_UPDATE_ACK, NetMessageType::NET_TIME_SYNC, NetMessageType::SCRIPT_JOIN, NetMessageType::SCRIPT_JOIN_ACK, NetMessageType::SCRIPT_JOIN_HOST_ACK, NetMessageType::SCRIPT_HANDSHAKE, NetMessageType::SCRIPT_BOT_HANDSHAKE_ACK});
-		if (std::find(unloggables.begin(), unloggables.end(), msg_type) == unloggables.end())
+		if (std::find(unloggables.begin(), unloggables.end(), msg_type) == unloggables.end() && LOG_LIMITED_ALLOWED(VERBOSE))
 		{
 			std::string player_name = std::format("{}.{}.{}.{}:{}",
 			    frame->m_Address.m_external_ip.m_field1,
@@ -167,6 +168,8 @@ namespace YimMenu::Hooks
 			return BaseHook::Get<Protections::ReceiveNetMessage, DetourHook<decltype(&Protections::ReceiveNetMessage)>>()->Original()(a1, ncm, frame);
 		}
 
+		FlightRecorder::Record(FlightEvent::NET_MESSAGE, static_cast<std::uint64_t>(msg_type), frame->m_Length, static_cast<std::uint32_t>(frame->m_MsgId));
+
 		if (Features::_LogPackets.GetState())
 		{
 			LogFrame(frame);
@@ -217,7 +220,7 @@ namespace YimMenu::Hooks
 		{
 			if (*Pointers.IsSessionStarted && Features::_LockLobby.GetState())
 			{
-				LOG(WARNING) << "Denying a player from joining";
+				LOG_LIMITED(WARNING) << "Denying a player from joining";
 				return true;
 			}
 			break;
@@ -1,13 +1,20 @@
 #include "core/hooking/DetourHook.hpp"
 #include "game/hooks/Hooks.hpp"
 #include "game/backend/ScriptMgr.hpp"
+#include "game/rdr/Scripts.hpp"
 
 namespace YimMenu::Hooks
 {
 	bool Script::RunScriptThreads(void* threads, int unk)
 	{
 		if (g_Running)
-			ScriptMgr::Tick();
+		{
+			// our scripts call natives, so they have to run in the context of a game script
+			if (auto startup = Scripts::FindScriptThread("startup"_J))
+				Scripts::RunAsScript(startup, [] {
+					ScriptMgr::Tick();
+				});
+		}
 		return BaseHook::Get<Script::RunScriptThreads, DetourHook<decltype(&RunScriptThreads)>>()->Original()(threads, unk);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,223 @@
+#pragma once
+#include "core/memory/Pattern.hpp"
+
+// kept apart from Pointers.cpp so tools can scan for them without pulling in the game headers
+namespace YimMenu::Patterns
+{
+	inline const auto Swapchain = Pattern<"48 8B 58 60 48 8B 0D">("IDXGISwapChain1");
+	inline const auto CommandQueue = Pattern<"FF 50 10 48 8B 0D ? ? ? ? 48 8B 01">("ID3D12CommandQueue");
+	inline const auto GetRendererInfo = Pattern<"E8 ? ? ? ? 38 58 09">("GetRendererInfo");
+	inline const auto GfxInformation = Pattern<"48 8D 0D ? ? ? ? 48 8B F8 E8 ? ? ? ? 45 33 ED 45 84 FF">("GFXInformation");
+	inline const auto KeyboardHook = Pattern<"41 8D 49 0D">("KeyboardHook");
+	inline const auto WndProc = Pattern<"48 89 5C 24 ? 4C 89 4C 24 ? 48 89 4C 24 ? 55 56 57 41 54 41 55 41 56 41 57 48 8B EC 48 83 EC 60">("WndProc");
+	inline const auto IsSessionStarted = Pattern<"40 38 35 ? ? ? ? 74 4D">("IsSessionStarted");
+	inline const auto GetNativeHandler = Pattern<"E8 ? ? ? ? 42 8B 9C FE">("GetNativeHandler");
+	inline const auto FixVectors = Pattern<"8B 41 18 4C 8B C1 85">("FixVectors");
+	inline const auto ScriptThreads = Pattern<"48 8D 0D ? ? ? ? E8 ? ? ? ? EB 0B 8B 0D">("ScriptThreads&RunScriptThreads");
+	inline const auto ScriptPrograms = Pattern<"C1 EF 0E 85 FF 74 21">("ScriptPrograms");
+	inline const auto CurrentScriptThread = Pattern<"48 89 2D ? ? ? ? 48 89 2D ? ? ? ? 48 8B 04 F9">("CurrentScriptThread&ScriptVM");
+	inline const auto SendMetric = Pattern<"48 89 5C 24 08 48 89 74 24 10 57 48 83 EC 20 48 8B F1 48 8B FA B1">("SendMetric");
+	inline const auto VmDetectionCallback = Pattern<"48 8B 0D ? ? ? ? E8 ? ? ? ? 48 8B 0D ? ? ? ? 8D 7E">("VMDetectionCallback");
+	inline const auto QueueDependency = Pattern<"E8 ? ? ? ? EB 43 8A 43 54">("QueueDependency");
+	inline const auto UnkFunction = Pattern<"40 53 48 83 EC 20 48 8B 59 20 48 8B 43 08 48 8B 4B">("UnkFunction");
+	inline const auto ScriptGlobals = Pattern<"48 8D 15 ? ? ? ? 48 8B 1D ? ? ? ? 8B 3D">("ScriptGlobals");
+	inline const auto HandleNetGameEvent = Pattern<"E8 ? ? ? ? F6 43 28 01 74 05 8B 7B 0C EB 03 8B 7B 14 48 8B CB E8 ? ? ? ? 2B F8 83 FF 28 0F 8D C9 FE FF FF">("HandleNetGameEvent");
+	inline const auto SendEventAck = Pattern<"E8 ? ? ? ? F6 43 32 01 74 4B">("SendEventAck");
+	inline const auto EnumerateAudioDevices = Pattern<"48 89 5C 24 08 48 89 74 24 10 48 89 7C 24 18 55 48 8B EC 48 83 EC 60 33 C0 41">("EnumerateAudioDevices");
+	inline const auto DirectSoundCaptureCreate = Pattern<"E8 ? ? ? ? 85 C0 79 08 48 83 23 00 32 C0 EB 7B">("DirectSoundCaptureCreate");
+	inline const auto Hwnd = Pattern<"4C 8B 05 ? ? ? ? 4C 8D 0D ? ? ? ? 48 89 54 24">("Hwnd");
+	inline const auto HandleToPtr = Pattern<"E8 ? ? ? ? 45 8D 47 04">("HandleToPtr");
+	inline const auto PtrToHandle = Pattern<"E8 ? ? ? ? F3 0F 10 0D ? ? ? ? 48 8D 4D DF 8B 5B 40">("PtrToHandle");
+	inline const auto GetLocalPed = Pattern<"8A 05 ? ? ? ? 33 D2 84 C0 74 39 48 8B 0D ? ? ? ? 4C 8B 05 ? ? ? ? 48 C1 C9 05 48 C1 C1 20 4C 33 C1 8B C1 83 E0 1F 49 C1 C0 20 FF C0 8A C8 8A 05 ? ? ? ? 49 D3 C0 84 C0 74 06 49 8B D0 48 F7 D2 48 8B 42">("GetLocalPed");
+	inline const auto HandleCloneCreate = Pattern<"48 8B C4 48 89 58 08 48 89 68 10 48 89 70 20 66 44 89 40 18 57 41 54 41 55 41 56 41 57 48 83">("HandleCloneCreate");
+	inline const auto HandleCloneSync = Pattern<"48 89 5C 24 08 48 89 6C 24 10 48 89 74 24 18 57 41 56 41 57 48 83 EC 40 4C 8B F2">("HandleCloneSync");
+	inline const auto GetCloneCreateResponse = Pattern<"8D 45 F8 1B F6 66 44 3B F0">("GetCloneCreateResponse");
+	inline const auto CanApplyData = Pattern<"48 8B C4 48 89 58 08 48 89 70 10 48 89 78 18 4C 89 70 20 41 57 48 83 EC 30 4C 8B FA">("CanApplyData");
+	inline const auto GetSyncTreeForType = Pattern<"0F B7 CA 83 F9">("GetSyncTreeForType");
+	inline const auto ResetSyncNodes = Pattern<"E8 ? ? ? ? E8 ? ? ? ? B9 0E 00 00 00 E8 ? ? ? ? 48 8B CB E8 ? ? ? ? E8 ? ? ? ? B9 0F 00 00 00 E8 ? ? ? ? E8">("ResetSyncNodes");
+	inline const auto ThrowFatalError = Pattern<"48 83 EC 28 45 33 C9 E8 ? ? ? ? CC">("ThrowFatalError");
+	inline const auto IsAnimSceneInScope = Pattern<"74 78 4C 8B 03 48 8B CB">("IsAnimSceneInScope");
+	inline const auto BroadcastNetArray = Pattern<"48 89 5C 24 ? 48 89 54 24 ? 55 56 57 41 54 41 55 41 56 41 57 48 83 EC ? 48 8B 81 ? ? ? ? 4C 8B F1">("BroadcastNetArray");
+	inline const auto InventoryEventCtor = Pattern<"C7 41 10 55 2B 70 40">("InventoryEventConstructor");
+	inline const auto EventGroupNetwork = Pattern<"80 78 47 00 75 52 48 8B 35">("EventGroupNetwork");
+	inline const auto NetworkRequest = Pattern<"4C 8B DC 49 89 5B 08 49 89 6B 10 49 89 73 18 57 48 81 EC ? ? ? ? 48 8B 01">("NetworkRequest");
+	inline const auto HandleScriptedGameEvent = Pattern<"40 53 48 81 EC 10 02 00 00 48 8B D9 48 8B">("HandleScriptedGameEvent");
+	inline const auto AddObjectToCreationQueue = Pattern<"0F 83 00 01 00 00 4D 8B C8">("AddObjectToCreationQueue");
+	inline const auto PlayerHasJoined = Pattern<"E8 ? ? ? ? 8A 4B 19 48 8B 45 38">("PlayerHasJoined");
+	inline const auto PlayerHasLeft = Pattern<"E8 ? ? ? ? 48 8B 0D ? ? ? ? 48 8B 57 08">("PlayerHasLeft");
+	inline const auto NetworkPlayerMgr = Pattern<"48 89 5C 24 08 57 48 83 EC 30 48 8B ? ? ? ? 01 8A D9 80 F9 20">("NetworkPlayerMgr");
+	inline const auto GetNetworkPlayerFromPid = Pattern<"E8 ? ? ? ? B2 01 8B CB 48 8B F8">("GetNetworkPlayerFromPid");
+	inline const auto GetNetObjectById = Pattern<"E8 ? ? ? ? 48 85 C0 74 20 80 78 47 00">("GetNetObjectById");
+	inline const auto AddExplosionBypass = Pattern<"0F 84 ? ? ? ? 44 38 3D ? ? ? ? 75 14">("ExplosionBypass");
+	inline const auto WorldToScreen = Pattern<"E8 ? ? ? ? 84 C0 74 19 F3 0F 10 44 24">("WorldToScreen");
+	inline const auto WritePlayerHealthData = Pattern<"48 89 5C 24 08 48 89 74 24 10 57 48 83 EC 30 48 8B B1 A8">("WritePlayerHealthData");
+	inline const auto RequestControl = Pattern<"E8 ? ? ? ? 32 C0 48 83 C4 ? 5B C3 B0 ? EB ? 48 8D 0D">("RequestControl");
+	inline const auto GetAnimSceneFromHandle = Pattern<"00 83 F9 04 7C 0F">("GetAnimSceneFromHandle");
+	inline const auto NetworkObjectMgr = Pattern<"74 44 0F B7 56 40">("NetworkObjectMgr");
+	inline const auto SendPacket = Pattern<"8B 44 24 60 48 8B D6 48 8B CD">("SendPacket");
+	inline const auto QueuePacket = Pattern<"E8 ?? ?? ?? ?? FF C6 49 83 C6 08 3B B7 88 40 00 00">("QueuePacket");
+	inline const auto ReceiveNetMessage = Pattern<"E8 ?? ?? ?? ?? EB 24 48 8D B7 90 02 00 00">("ReceiveNetMessage");
+	inline const auto HandlePresenceEvent = Pattern<"0F 84 00 03 00 00 85 C9">("HandlePresenceEvent");
+	inline const auto PostMessage = Pattern<"E8 ?? ?? ?? ?? EB 35 C7 44 24 20 D9 7A 70 E1">("PostPresenceMessage");
+	inline const auto SendNetInfoToLobby = Pattern<"E8 ?? ?? ?? ?? 32 DB 84 C0 74 1B 44 8B 84 24 40 01 00 00">("SendNetInfoToLobby");
+	inline const auto PedPool = Pattern<"0F 28 F0 48 85 DB 74 56 8A 05 ? ? ? ? 84 C0 75 05">("PedPool");
+	inline const auto ObjectPool = Pattern<"3C 05 75 67">("ObjectPool");
+	inline const auto VehiclePool = Pattern<"48 83 EC 20 8A 05 ? ? ? ? 45 33 E4">("VehiclePool");
+	inline const auto PickupPool = Pattern<"0F 84 ? ? ? ? 8A 05 ? ? ? ? 48 85">("PickupPool");
+	inline const auto ScriptHandlePool = Pattern<"8A 05 ?? ?? ?? ?? 33 FF 48 89 3D">("ScriptHandlePool");
+	inline const auto FwScriptGuidCreateGuid = Pattern<"E8 ? ? ? ? B3 01 8B 15">("FwScriptGuidCreateGuid");
+	inline const auto ReceiveServerMessage = Pattern<"48 89 5C 24 08 57 48 83 EC 20 48 8B 02 48 8B F9 48 8B CA 48 8B DA FF 50 ?? 48 8B C8">("ReceiveServerMessage");
+	inline const auto SerializeServerRPC = Pattern<"48 89 5C 24 08 57 48 83 EC 30 48 8B 44 24 70">("SerializeServerRPC");
+	inline const auto ReadBBArray = Pattern<"48 89 5C 24 08 57 48 83 EC 30 41 8B F8 4C">("ReadBitBufferArray");
+	inline const auto WriteBBArray = Pattern<"48 89 5C 24 08 57 48 83 EC 30 F6 41 28">("WriteBitBufferArray");
+	inline const auto ReadBBString = Pattern<"48 89 5C 24 08 48 89 6C 24 18 56 57 41 56 48 83 EC 20 45 8B">("ReadBitBufferString");
+	inline const auto InitNativeTables = Pattern<"41 B0 01 44 39 51 2C 0F">("InitNativeTables");
+	inline const auto TriggerWeaponDamageEvent = Pattern<"89 44 24 58 8B 47 F8 89">("TriggerWeaponDamageEvent");
+	inline const auto ScSession = Pattern<"3B 1D ? ? ? ? 76 60">("ScSession");
+	inline const auto ReceiveArrayUpdate = Pattern<"48 89 5C 24 10 55 56 57 41 54 41 55 41 56 41 57 48 8B EC 48 83 EC 50 48 8B D9 45">("ReceiveArrayUpdate");
+	inline const auto WriteVPMData = Pattern<"48 8B C4 48 89 58 10 48 89 68 18 48 89 70 20 48 89 48 08 57 41 54 41 55 41 56 41 57 48 83 EC 30 4C 8B A9">("WriteVehicleProximityMigrationData");
+	inline const auto TriggerGiveControlEvent = Pattern<"48 8B C4 48 89 58 ? 48 89 68 ? 48 89 70 ? 48 89 78 ? 41 54 41 56 41 57 48 83 EC ? 65 4C 8B 0C 25">("TriggerGiveControlEvent");
+	inline const auto CreatePoolItem = Pattern<"BA EF 4F 91 02">("CreatePoolItem");
+	inline const auto HandleCloneRemove = Pattern<"48 8B C4 48 89 58 ? 48 89 68 ? 48 89 70 ? 48 89 78 ? 41 54 41 56 41 57 48 81 EC ? ? ? ? 4D 8B E0 4C 8B FA">("HandleCloneRemove");
+	inline const auto HandleSessionEvent = Pattern<"83 F9 16 0F 8F 0B">("HandleSessionEvent");
+	inline const auto RequestSessionSeamless = Pattern<"83 64 24 20 00 41 B8 40 00 00 00">("RequestSessionSeamless");
+	inline const auto GetDiscriminator = Pattern<"83 E3 01 C1 E3 0A E8">("GetDiscriminator");
+	inline const auto ObjectIdMap = Pattern<"83 C0 13 3D 00 20 00 00">("ObjectIdMap");
+	inline const auto WriteNodeData = Pattern<"48 8B 89 18 01 00 00 4C 8B 11 49 FF 62 10">("WriteNodeData");
+	inline const auto TotalProgramCount = Pattern<"44 3B CF 75 E9 41 8B DB">("TotalProgramCount");
+	inline const auto SendVoicePacket = Pattern<"4C 8D 8C 24 B0 00 00 00 45 8B C4">("SendVoicePacket");
+	inline const auto WriteVoiceInfoData = Pattern<"8B 57 04 41 B8 07 00 00 00">("WriteVoiceInfoData");
+	inline const auto FriendRegistry = Pattern<"4C 8D 05 ? ? ? ? 48 8B CB E8 ? ? ? ? 84 C0 75 07 B8 4F 3D E1 01">("FriendRegistry");
+	inline const auto PackCloneCreate = Pattern<"FF 90 90 01 00 00 33 DB">("PackCloneCreate");
+	inline const auto WriteSyncTree = Pattern<"0F 84 A4 00 00 00 48 8B 07 45 8B C4">("WriteSyncTree");
+	inline const auto ShouldUseNodeCache = Pattern<"83 FA 20 75 03">("ShouldUseNodeCache");
+	inline const auto IsNodeInScope = Pattern<"41 83 F9 02 74 25">("IsNodeInScope");
+	inline const auto SetTreeErrored = Pattern<"80 BB 9C 01 00 00 00 74 0B">("SetTreeErrored");
+	inline const auto SetTreeTargetObject = Pattern<"48 89 7C CE 08 48 8B 74 24 38">("SetTreeTargetObject");
+	inline const auto PhysicsHandleLassoAttachment = Pattern<"EB 3B 40 84 ED 74 36">("PhysicsHandleLassoAttachment");
+	inline const auto DecideConnectionMethod = Pattern<"81 7D 30 98 3A 00 00 76 06">("DecideConnectionMethod");
+	inline const auto HandlePeerRelayPacket = Pattern<"48 8B C4 48 89 58 ? 48 89 68 ? 48 89 70 ? 57 48 83 EC ? F6 81 ? ? ? ? ? 41 8B F9">("HandlePeerRelayPacket");
+	inline const auto UnpackPacket = Pattern<"48 89 5C 24 ? 55 56 57 41 54 41 55 41 56 41 57 48 8D AC 24 ? ? ? ? 48 81 EC ? ? ? ? 41 8D 41">("UnpackPacket");
+	inline const auto UpdateEndpointAddress = Pattern<"48 89 5C 24 ? 48 89 74 24 ? 48 89 7C 24 ? 55 41 56 41 57 48 8B EC 48 81 EC ? ? ? ? 4C 8D B9">("UpdateEndpointAddress");
+	inline const auto TrainConfigs = Pattern<"41 39 09 74 11">("TrainConfigs");
+	inline const auto SerializeIceSessionOfferRequest = Pattern<"80 3F 03 0F 85 9C 01 00 00">("SerializeIceSessionOfferRequest");
+	inline const auto OpenIceTunnel = Pattern<"66 44 39 6D 58 0F 84 1D 01 00 00">("OpenIceTunnel");
+	inline const auto CanCreateNetworkObject = Pattern<"B8 81 00 20 00 85 FF">("CanCreateNetworkObject");
+	inline const auto GetTextLabel = Pattern<"BB 1A 00 00 00 48 8D 0D">("GetTextLabel");
+	inline const auto WeaponComponentPatch = Pattern<"0F 85 9E 00 00 00 45 39 19">("WeaponComponentPatch");
+	inline const auto GetPoolSize = Pattern<"BA F7 01 22 5F">("GetPoolSize");
+	inline const auto CheckConditionIsMale = Pattern<"C0 E8 03 24 01 EB 26">("CheckConditionIsMale");
+	inline const auto CheckConditionIsFemale = Pattern<"74 27 48 8B 82 00 01 00 00 48 85 C0 74 10">("CheckConditionIsFemale");
+	inline const auto ScriptUiDrawFlags = Pattern<"41 8D 51 0E EB 05 BA">("ScriptUIDrawFlags");
+	inline const auto RegisterCompappNatives = Pattern<"A1 26 01 0C">("RegisterCompappNatives");
+
+	// every pattern resolved by Pointers::Init, in registration order
+	inline const IPattern* const All[] = {
+	    &Swapchain,
+	    &CommandQueue,
+	    &GetRendererInfo,
+	    &GfxInformation,
+	    &KeyboardHook,
+	    &WndProc,
+	    &IsSessionStarted,
+	    &GetNativeHandler,
+	    &FixVectors,
+	    &ScriptThreads,
+	    &ScriptPrograms,
+	    &CurrentScriptThread,
+	    &SendMetric,
+	    &VmDetectionCallback,
+	    &QueueDependency,
+	    &UnkFunction,
+	    &ScriptGlobals,
+	    &HandleNetGameEvent,
+	    &SendEventAck,
+	    &EnumerateAudioDevices,
+	    &DirectSoundCaptureCreate,
+	    &Hwnd,
+	    &HandleToPtr,
+	    &PtrToHandle,
+	    &GetLocalPed,
+	    &HandleCloneCreate,
+	    &HandleCloneSync,
+	    &GetCloneCreateResponse,
+	    &CanApplyData,
+	    &GetSyncTreeForType,
+	    &ResetSyncNodes,
+	    &ThrowFatalError,
+	    &IsAnimSceneInScope,
+	    &BroadcastNetArray,
+	    &InventoryEventCtor,
+	    &EventGroupNetwork,
+	    &NetworkRequest,
+	    &HandleScriptedGameEvent,
+	    &AddObjectToCreationQueue,
+	    &PlayerHasJoined,
+	    &PlayerHasLeft,
+	    &NetworkPlayerMgr,
+	    &GetNetworkPlayerFromPid,
+	    &GetNetObjectById,
+	    &AddExplosionBypass,
+	    &WorldToScreen,
+	    &WritePlayerHealthData,
+	    &RequestControl,
+	    &GetAnimSceneFromHandle,
+	    &NetworkObjectMgr,
+	    &SendPacket,
+	    &QueuePacket,
+	    &ReceiveNetMessage,
+	    &HandlePresenceEvent,
+	    &PostMessage,
+	    &SendNetInfoToLobby,
+	    &PedPool,
+	    &ObjectPool,
+	    &VehiclePool,
+	    &PickupPool,
+	    &ScriptHandlePool,
+	    &FwScriptGuidCreateGuid,
+	    &ReceiveServerMessage,
+	    &SerializeServerRPC,
+	    &ReadBBArray,
+	    &WriteBBArray,
+	    &ReadBBString,
+	    &InitNativeTables,
+	    &TriggerWeaponDamageEvent,
+	    &ScSession,
+	    &ReceiveArrayUpdate,
+	    &WriteVPMData,
+	    &TriggerGiveControlEvent,
+	    &CreatePoolItem,
+	    &HandleCloneRemove,
+	    &HandleSessionEvent,
+	    &RequestSessionSeamless,
+	    &GetDiscriminator,
+	    &ObjectIdMap,
+	    &WriteNodeData,
+	    &TotalProgramCount,
+	    &SendVoicePacket,
+	    &WriteVoiceInfoData,
+	    &FriendRegistry,
+	    &PackCloneCreate,
+	    &WriteSyncTree,
+	    &ShouldUseNodeCache,
+	    &IsNodeInScope,
+	    &SetTreeErrored,
+	    &SetTreeTargetObject,
+	    &PhysicsHandleLassoAttachment,
+	    &DecideConnectionMethod,
+	    &HandlePeerRelayPacket,
+	    &UnpackPacket,
+	    &UpdateEndpointAddress,
+	    &TrainConfigs,
+	    &SerializeIceSessionOfferRequest,
+	    &OpenIceTunnel,
+	    &CanCreateNetworkObject,
+	    &GetTextLabel,
+	    &WeaponComponentPatch,
+	    &GetPoolSize,
+	    &CheckConditionIsMale,
+	    &CheckConditionIsFemale,
+	    &ScriptUiDrawFlags,
+	    &RegisterCompappNatives,
+	};
+}
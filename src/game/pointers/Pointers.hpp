@@ -1,12 +1,16 @@
 #pragma once
+#include "core/memory/PatternScanner.hpp"
 #include "game/rdr/GraphicsOptions.hpp"
 #include "game/rdr/RenderingInfo.hpp"
 
 #include <d3d12.h>
 #include <dxgi1_4.h>
+#include <future>
+#include <memory>
 #include <rage/atArray.hpp>
 #include <rage/vector.hpp>
 #include <script/scrNativeHandler.hpp>
+#include <thread>
 #include <vulkan/vulkan.h>
 #include <windows.h>
 
@@ -244,9 +248,37 @@ namespace YimMenu
 
 	struct Pointers : PointerData
 	{
+		/**
+		 * @brief Resolves the critical patterns and starts resolving the others in the background
+		 */
 		bool Init();
+		/**
+		 * @brief Waits for every pattern to be resolved and persists the pattern cache
+		 */
 		bool LateInit();
 		void Restore();
+
+		/**
+		 * @brief Future-style handle that becomes ready once every pattern of the tier has been resolved
+		 * 
+		 * @return std::shared_future<bool> Holds whether all patterns of the tier have been found, invalid before Init()
+		 */
+		std::shared_future<bool> Resolved(PatternPriority priority) const;
+		/**
+		 * @brief Blocks until the tier has been resolved
+		 * 
+		 * @return true If all patterns of the tier have been found
+		 */
+		bool WaitFor(PatternPriority priority) const;
+		/**
+		 * @brief Non-blocking check for consumers of pointers that may be used before LateInit()
+		 */
+		bool IsAvailable(PatternPriority priority) const;
+
+	private:
+		std::unique_ptr<PatternScanner> m_Scanner;
+		std::array<std::shared_future<bool>, 3> m_Resolved;
+		std::thread m_Resolver;
 	};
 
 	inline YimMenu::Pointers Pointers;
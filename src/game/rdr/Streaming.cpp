@@ -0,0 +1,18 @@
+#include "Streaming.hpp"
+
+#include "Natives.hpp"
+#include "game/backend/ScriptMgr.hpp"
+
+namespace YimMenu
+{
+	Task<bool> ModelLoaded(std::uint32_t model, int max_ticks)
+	{
+		for (int i = 0; i < max_ticks && !STREAMING::HAS_MODEL_LOADED(model); i++)
+		{
+			STREAMING::REQUEST_MODEL(model, false);
+			co_await NextTick();
+		}
+
+		co_return STREAMING::HAS_MODEL_LOADED(model);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+#include "core/misc/Task.hpp"
+
+#include <cstdint>
+
+namespace YimMenu
+{
+	/**
+	 * @brief co_await ModelLoaded(model) requests the model once per tick until it is loaded, false if that took longer than max_ticks
+	 */
+	Task<bool> ModelLoaded(std::uint32_t model, int max_ticks = 30);
+}
\ No newline at end of file
@@ -0,0 +1,798 @@
+#include "SyncNodeLayouts.hpp"
+
+#include "game/rdr/Nodes.hpp"
+
+#include <network/sync/animal/CAnimalCreationData.hpp>
+#include <network/sync/object/CObjectCreationData.hpp>
+#include <network/sync/ped/CPedAttachData.hpp>
+#include <network/sync/ped/CPedCreationData.hpp>
+#include <network/sync/ped/CPedTaskTreeData.hpp>
+#include <network/sync/physical/CPhysicalAttachData.hpp>
+#include <network/sync/pickup/CPickupCreationData.hpp>
+#include <network/sync/player/CPlayerAppearanceData.hpp>
+#include <network/sync/propset/CPropSetCreationData.hpp>
+#include <network/sync/vehicle/CVehicleCreationData.hpp>
+#include <network/sync/vehicle/CVehicleGadgetData.hpp>
+#include <network/sync/vehicle/CVehicleProximityMigrationData.hpp>
+
+namespace YimMenu
+{
+	static constexpr SyncField g_PedCreationFields[] = {
+	    SYNC_FIELD(CPedCreationData, m_PopulationType),
+	    SYNC_FIELD_H(CPedCreationData, m_ModelHash),
+	    SYNC_FIELD(CPedCreationData, m_BannedPed),
+	};
+
+	static constexpr SyncField g_AnimalCreationFields[] = {
+	    SYNC_FIELD(CAnimalCreationData, m_PopulationType),
+	    SYNC_FIELD_H(CAnimalCreationData, m_ModelHash),
+	    SYNC_FIELD(CAnimalCreationData, m_BannedPed),
+	};
+
+	static constexpr SyncField g_ObjectCreationFields[] = {
+	    SYNC_FIELD(CObjectCreationData, m_ObjectType),
+	    SYNC_FIELD_H(CObjectCreationData, m_ModelHash),
+	};
+
+	static constexpr SyncField g_PlayerAppearanceFields[] = {
+	    SYNC_FIELD_H(CPlayerAppearanceData, m_ModelHash),
+	    SYNC_FIELD(CPlayerAppearanceData, m_BannedPlayerModel),
+	};
+
+	static constexpr SyncField g_VehicleCreationFields[] = {
+	    SYNC_FIELD(CVehicleCreationData, m_PopulationType),
+	    SYNC_FIELD_H(CVehicleCreationData, m_ModelHash),
+	};
+
+	static constexpr SyncField g_PickupCreationFields[] = {
+	    SYNC_FIELD_H(CPickupCreationData, m_PickupHash),
+	    SYNC_FIELD_H(CPickupCreationData, m_ModelHash),
+	};
+
+	static constexpr SyncField g_PhysicalAttachFields[] = {
+	    SYNC_FIELD(CPhysicalAttachData, m_IsAttached),
+	    SYNC_FIELD(CPhysicalAttachData, m_AttachObjectId),
+	    SYNC_FIELD(CPhysicalAttachData, m_Offset),
+	    SYNC_FIELD(CPhysicalAttachData, m_Orientation),
+	    SYNC_FIELD(CPhysicalAttachData, m_ParentOffset),
+	    SYNC_FIELD(CPhysicalAttachData, m_OtherAttachBone),
+	    SYNC_FIELD(CPhysicalAttachData, m_AttachBone),
+	    SYNC_FIELD(CPhysicalAttachData, m_AttachFlags),
+	};
+
+	static constexpr SyncField g_VehicleProximityMigrationFields[] = {
+	    SYNC_FIELD(CVehicleProximityMigrationData, m_NumPassengers),
+	    SYNC_FIELD(CVehicleProximityMigrationData, m_OverridePopulationType),
+	    SYNC_FIELD(CVehicleProximityMigrationData, m_PopulationType),
+	    SYNC_FIELD(CVehicleProximityMigrationData, m_Flags),
+	    SYNC_FIELD(CVehicleProximityMigrationData, m_Timestamp),
+	    SYNC_FIELD(CVehicleProximityMigrationData, m_HasPositionData),
+	    SYNC_FIELD(CVehicleProximityMigrationData, m_Position),
+	    SYNC_FIELD(CVehicleProximityMigrationData, m_UnkAmount),
+	};
+
+	static constexpr SyncField g_PedTaskTreeFields[] = {
+	    SYNC_FIELD(CPedTaskTreeData, m_Trees[0].m_TreeType),
+	};
+
+	// the number of trees and tasks is part of the node
+	static void FormatPedTaskTree(std::string& out, const std::uint8_t* data)
+	{
+		CPedTaskTreeData tree;
+		std::memcpy(&tree, data, sizeof(tree));
+
+		for (int i = 0; i < tree.GetNumTaskTrees(); i++)
+		{
+			SyncNodeDumper::AppendValue(out, "m_Trees[i].m_NumTasks", tree.m_Trees[i].m_NumTasks);
+			SyncNodeDumper::AppendValue(out, "m_Trees[i].m_SequenceTree", tree.m_Trees[i].m_SequenceTree);
+			for (int j = 0; j < tree.m_Trees[i].m_NumTasks; j++)
+			{
+				SyncNodeDumper::AppendValue(out, "m_Trees[i].m_Tasks[j].m_TaskType", tree.m_Trees[i].m_Tasks[j].m_TaskType);
+				SyncNodeDumper::AppendValue(out, "m_Trees[i].m_Tasks[j].m_TaskUnk1", tree.m_Trees[i].m_Tasks[j].m_TaskUnk1);
+				SyncNodeDumper::AppendValue(out, "m_Trees[i].m_Tasks[j].m_TaskTreeType", tree.m_Trees[i].m_Tasks[j].m_TaskTreeType);
+				SyncNodeDumper::AppendValue(out, "m_Trees[i].m_Tasks[j].m_TaskSequenceId", tree.m_Trees[i].m_Tasks[j].m_TaskSequenceId);
+				SyncNodeDumper::AppendValue(out, "m_Trees[i].m_Tasks[j].m_TaskTreeDepth", tree.m_Trees[i].m_Tasks[j].m_TaskTreeDepth);
+			}
+		}
+		SyncNodeDumper::AppendValue(out, "m_ScriptCommand", tree.m_ScriptCommand, SyncFieldFormat::HEX);
+		SyncNodeDumper::AppendValue(out, "m_ScriptTaskStage", tree.m_ScriptTaskStage);
+	}
+
+	static constexpr SyncField g_PedAttachFields[] = {
+	    SYNC_FIELD(CPedAttachData, m_IsAttached),
+	    SYNC_FIELD(CPedAttachData, m_AttachObjectId),
+	};
+
+	static constexpr SyncField g_VehicleGadgetFields[] = {
+	    SYNC_FIELD(CVehicleGadgetData, m_HasPosition),
+	    SYNC_FIELD(CVehicleGadgetData, m_Position[0]),
+	    SYNC_FIELD(CVehicleGadgetData, m_Position[1]),
+	    SYNC_FIELD(CVehicleGadgetData, m_Position[2]),
+	    SYNC_FIELD(CVehicleGadgetData, m_Position[3]),
+	    SYNC_FIELD(CVehicleGadgetData, m_NumGadgets),
+	};
+
+	static void FormatVehicleGadget(std::string& out, const std::uint8_t* data)
+	{
+		CVehicleGadgetData gadgets;
+		std::memcpy(&gadgets, data, sizeof(gadgets));
+
+		if (gadgets.m_NumGadgets > 2)
+			return;
+
+		for (int i = 0; i < gadgets.m_NumGadgets; i++)
+			SyncNodeDumper::AppendValue(out, "m_Gadgets[i].m_Type", gadgets.m_Gadgets[i].m_Type);
+	}
+
+	static constexpr SyncField g_PropSetCreationFields[] = {
+	    SYNC_FIELD_H(CPropSetCreationData, m_Hash),
+	    SYNC_FIELD_H(CPropSetCreationData, m_Type),
+	};
+
+	static constexpr SyncField g_ProjectileCreationFields[] = {
+	    SYNC_FIELD_AT(4, int),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(0x2C, int),
+	};
+
+	static constexpr SyncField g_TrainGameStateUncommonFields[] = {
+	    SYNC_FIELD_AT(0, int),
+	    SYNC_FIELD_AT(4, int),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(12, char), // config index
+	    SYNC_FIELD_AT(13, char),
+	    SYNC_FIELD_AT(14, char),
+	    SYNC_FIELD_AT(15, char),
+	    SYNC_FIELD_AT(16, char),
+	    SYNC_FIELD_AT(17, char),
+	    SYNC_FIELD_AT(18, char),
+	    SYNC_FIELD_AT(19, char),
+	    SYNC_FIELD_AT(20, char),
+	    SYNC_FIELD_AT(21, char),
+	    SYNC_FIELD_AT(22, char),
+	    SYNC_FIELD_AT(23, char),
+	    SYNC_FIELD_AT(24, char),
+	};
+
+	static constexpr SyncField g_TrainGameStateFields[] = {
+	    SYNC_FIELD_AT(0, int),
+	    SYNC_FIELD_AT(4, int),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(12, int),
+	    SYNC_FIELD_AT(16, int),
+	    SYNC_FIELD_AT(20, int),
+	    SYNC_FIELD_AT(24, int), // whistle sequence
+	    SYNC_FIELD_AT(28, char),
+	    SYNC_FIELD_AT(29, char),
+	    SYNC_FIELD_AT(30, char), // track index?
+	    SYNC_FIELD_AT(31, char),
+	    SYNC_FIELD_AT(32, char),
+	    SYNC_FIELD_AT(33, char),
+	    SYNC_FIELD_AT(34, char),
+	    SYNC_FIELD_AT(35, char),
+	    SYNC_FIELD_AT(36, char),
+	    SYNC_FIELD_AT(37, char),
+	    SYNC_FIELD_AT(38, char),
+	    SYNC_FIELD_AT(39, char),
+	    SYNC_FIELD_AT(40, char),
+	};
+
+	static constexpr SyncField g_TrainControlFields[] = {
+	    SYNC_FIELD_AT(160, float),
+	    SYNC_FIELD_AT(164, char),
+	};
+
+	static constexpr SyncField g_AnimSceneCreationFields[] = {
+	    SYNC_FIELD_AT(0, int),
+	    SYNC_FIELD_AT(4, int),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(12, int),
+	    SYNC_FIELD_AT(16, char),
+	    //SYNC_FIELD_AT(32, __int128),
+	    //SYNC_FIELD_AT(48, __int128),
+	    //SYNC_FIELD_AT(64, __int128),
+	    //SYNC_FIELD_AT(80, __int128),
+	    //SYNC_FIELD_AT(96, __int128),
+	    SYNC_FIELD_AT(112, int16_t),
+	    SYNC_FIELD_AT(114, int16_t),
+	};
+
+	static constexpr SyncField g_AnimSceneFrequentFields[] = {
+	    SYNC_FIELD_AT(0, int),
+	    SYNC_FIELD_AT(4, char),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(12, int),
+	};
+
+	static constexpr SyncField g_AnimSceneInfrequentFields[] = {
+	    SYNC_FIELD_AT(16, int),
+	    SYNC_FIELD_AT(20, char),
+	    SYNC_FIELD_AT(24, int16_t),
+	    SYNC_FIELD_AT(26, char),
+	    SYNC_FIELD_AT(32, int64_t),
+	    SYNC_FIELD_AT(40, int64_t),
+	};
+
+	static constexpr SyncField g_PedGameStateCommonFields[] = {
+	    SYNC_FIELD_AT(0, int),
+	    SYNC_FIELD_AT(4, int),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(12, int),
+	    SYNC_FIELD_AT(16, int),
+	    SYNC_FIELD_AT(20, float),
+	    SYNC_FIELD_AT(24, float),
+	    SYNC_FIELD_AT(28, float),
+	    SYNC_FIELD_AT(32, float),
+	    SYNC_FIELD_AT(36, float),
+	    SYNC_FIELD_AT(40, char),
+	    SYNC_FIELD_AT(44, int),
+	    SYNC_FIELD_AT(48, char),
+	    SYNC_FIELD_AT(50, char),
+	    SYNC_FIELD_AT(51, char),
+	    SYNC_FIELD_AT(52, char),
+	    SYNC_FIELD_AT(53, char),
+	    SYNC_FIELD_AT(54, char),
+	    SYNC_FIELD_AT(55, char),
+	};
+
+	static constexpr SyncField g_PedSectorPosMapFields[] = {
+	    SYNC_FIELD_AT(0, float),
+	    SYNC_FIELD_AT(4, float),
+	    SYNC_FIELD_AT(8, float),
+	    SYNC_FIELD_AT(12, bool), // using ragdoll?
+	    SYNC_FIELD_AT(13, char),
+	};
+
+	static constexpr SyncField g_PedSectorPosNavMeshFields[] = {
+	    SYNC_FIELD_AT(0, float),
+	    SYNC_FIELD_AT(4, float),
+	    SYNC_FIELD_AT(8, float),
+	};
+
+	static constexpr SyncField g_PedMovementFields[] = {
+	    SYNC_FIELD_AT(32, int),
+	    SYNC_FIELD_AT(44, int),
+	    SYNC_FIELD_AT(64, float),
+	    SYNC_FIELD_AT(68, int),
+	    SYNC_FIELD_AT(72, int),
+	    SYNC_FIELD_AT(76, int),
+	    SYNC_FIELD_AT(80, int),
+	    SYNC_FIELD_AT(84, int),
+	    SYNC_FIELD_AT(88, int),
+	    SYNC_FIELD_AT(92, char),
+	    SYNC_FIELD_AT(97, char),
+	};
+
+	static constexpr SyncField g_DraftVehControlFields[] = {
+	    SYNC_FIELD_AT(32, int),
+	    SYNC_FIELD_AT(36, int),
+	    SYNC_FIELD_AT(40, int),
+	    SYNC_FIELD_AT(44, int),
+	    SYNC_FIELD_AT(48, int),
+	    SYNC_FIELD_AT(52, char),
+	    SYNC_FIELD_AT(53, char),
+	    SYNC_FIELD_AT(54, char),
+	    SYNC_FIELD_AT(56, int),
+	    SYNC_FIELD_AT(60, int),
+	};
+
+	static constexpr SyncField g_Node_14359d020Fields[] = {
+	    //SYNC_FIELD_AT(16, OWORD),
+	    //SYNC_FIELD_AT(32, OWORD),
+	    //SYNC_FIELD_AT(48, OWORD),
+	    SYNC_FIELD_AT(64, int),
+	    SYNC_FIELD_AT(100, int),
+	    SYNC_FIELD_AT(140, int),
+	    //SYNC_FIELD_AT(160, __m128i),
+	    SYNC_FIELD_AT(176, int16_t),
+	    SYNC_FIELD_AT(178, int16_t),
+	    SYNC_FIELD_AT(180, int16_t),
+	    SYNC_FIELD_AT(184, int),
+	    SYNC_FIELD_AT(188, int),
+	    SYNC_FIELD_AT(196, int),
+	    SYNC_FIELD_AT(200, int),
+	    SYNC_FIELD_AT(204, int),
+	    SYNC_FIELD_AT(208, int),
+	    SYNC_FIELD_AT(212, int),
+	    SYNC_FIELD_AT(216, int),
+	    SYNC_FIELD_AT(220, char),
+	    SYNC_FIELD_AT(221, char),
+	    SYNC_FIELD_AT(222, char),
+	    SYNC_FIELD_AT(223, char),
+	    SYNC_FIELD_AT(224, char),
+	    SYNC_FIELD_AT(225, char),
+	    SYNC_FIELD_AT(226, char),
+	    SYNC_FIELD_AT(356, int),
+	    SYNC_FIELD_AT(360, int),
+	    SYNC_FIELD_AT(364, int),
+	    SYNC_FIELD_AT(368, int),
+	    SYNC_FIELD_AT(372, int),
+	    SYNC_FIELD_AT(376, int),
+	};
+
+	static constexpr SyncField g_VehicleControlFields[] = {
+	    SYNC_FIELD_AT(4, int),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(12, int),
+	    SYNC_FIELD_AT(16, int),
+	    SYNC_FIELD_AT(20, int),
+	    SYNC_FIELD_AT(24, char),
+	    SYNC_FIELD_AT(25, char),
+	    SYNC_FIELD_AT(26, char),
+	    SYNC_FIELD_AT(27, char),
+	};
+
+	static constexpr SyncField g_VehicleAngVelocityFields[] = {
+	    SYNC_FIELD_AT(0, int),
+	    SYNC_FIELD_AT(4, int),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(12, char),
+	};
+
+	static constexpr SyncField g_DraftVehHorseHealthFields[] = {
+	    SYNC_FIELD_AT(158, char),
+	    SYNC_FIELD_AT(656, char),
+	};
+
+	static constexpr SyncField g_VehicleGameStateFields[] = {
+	    SYNC_FIELD_AT(1, char),
+	    SYNC_FIELD_AT(2, char),
+	    SYNC_FIELD_AT(3, char),
+	    SYNC_FIELD_AT(4, char),
+	    SYNC_FIELD_AT(5, char),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(12, int),
+	    SYNC_FIELD_AT(16, int),
+	    SYNC_FIELD_AT(20, int),
+	    SYNC_FIELD_AT(24, int),
+	    SYNC_FIELD_AT(28, int),
+	    SYNC_FIELD_AT(32, int),
+	    SYNC_FIELD_AT(36, int),
+	    SYNC_FIELD_AT(40, int),
+	    SYNC_FIELD_AT(44, int16_t),
+	    SYNC_FIELD_AT(46, int16_t),
+	    SYNC_FIELD_AT(50, int16_t),
+	    SYNC_FIELD_AT(52, int16_t),
+	    SYNC_FIELD_AT(54, char),
+	    SYNC_FIELD_AT(55, int),
+	    SYNC_FIELD_AT(59, int16_t),
+	    SYNC_FIELD_AT(61, char),
+	    SYNC_FIELD_AT(62, char),
+	    SYNC_FIELD_AT(63, char),
+	    SYNC_FIELD_AT(104, char),
+	    SYNC_FIELD_AT(105, char),
+	    SYNC_FIELD_AT(106, char),
+	    SYNC_FIELD_AT(107, char),
+	    SYNC_FIELD_AT(108, char),
+	    SYNC_FIELD_AT(109, char),
+	    SYNC_FIELD_AT(110, char),
+	    SYNC_FIELD_AT(111, char),
+	    SYNC_FIELD_AT(112, char),
+	    SYNC_FIELD_AT(114, char),
+	    SYNC_FIELD_AT(115, char),
+	    SYNC_FIELD_AT(116, char),
+	    SYNC_FIELD_AT(117, char),
+	    SYNC_FIELD_AT(118, char),
+	    SYNC_FIELD_AT(119, char),
+	    SYNC_FIELD_AT(120, char),
+	    SYNC_FIELD_AT(121, char),
+	    SYNC_FIELD_AT(123, char),
+	    SYNC_FIELD_AT(124, char),
+	    SYNC_FIELD_AT(125, char),
+	    SYNC_FIELD_AT(126, char),
+	    SYNC_FIELD_AT(127, char),
+	    SYNC_FIELD_AT(128, char),
+	    SYNC_FIELD_AT(129, char),
+	    SYNC_FIELD_AT(130, char),
+	    SYNC_FIELD_AT(131, char), // has seat manager
+	    SYNC_FIELD_AT(132, char), // depends on the value of tunable 0xF03033E4
+	};
+
+	static constexpr SyncField g_PedStandingOnObjectFields[] = {
+	    SYNC_FIELD_AT(0, int16_t),
+	    SYNC_FIELD_AT(16, float), // also __m128i, not sure
+	    SYNC_FIELD_AT(20, float),
+	    SYNC_FIELD_AT(24, float),
+	    SYNC_FIELD_AT(32, int),
+	    SYNC_FIELD_AT(36, int),
+	    SYNC_FIELD_AT(40, int),
+	    SYNC_FIELD_AT(44, char),
+	    SYNC_FIELD_AT(45, char),
+	};
+
+	static constexpr SyncField g_Node_143594ab8Fields[] = {
+	    SYNC_FIELD_AT(0, char),
+	    SYNC_FIELD_AT(1, char),
+	    SYNC_FIELD_AT(2, char),
+	    SYNC_FIELD_AT(3, char),
+	    SYNC_FIELD_AT(4, char),
+	    SYNC_FIELD_AT(5, char),
+	    SYNC_FIELD_AT(6, char),
+	    SYNC_FIELD_AT(7, char),
+	    SYNC_FIELD_AT(8, char),
+	    SYNC_FIELD_AT(9, char),
+	    SYNC_FIELD_AT(12, int),
+	    SYNC_FIELD_AT(16, int),
+	    SYNC_FIELD_AT(20, int),
+	};
+
+	static constexpr SyncField g_VehicleScriptGameStateFields[] = {
+	    SYNC_FIELD_AT(96, char),
+	    SYNC_FIELD_AT(97, char),
+	    SYNC_FIELD_AT(98, char),
+	    SYNC_FIELD_AT(99, char),
+	    SYNC_FIELD_AT(100, char),
+	    SYNC_FIELD_AT(101, char),
+	    SYNC_FIELD_AT(102, char),
+	    SYNC_FIELD_AT(103, char),
+	    SYNC_FIELD_AT(104, char),
+	    SYNC_FIELD_AT(105, char),
+	    SYNC_FIELD_AT(106, char),
+	    SYNC_FIELD_AT(107, char),
+	    SYNC_FIELD_AT(108, char),
+	    SYNC_FIELD_AT(109, char),
+	    SYNC_FIELD_AT(110, char),
+	    SYNC_FIELD_AT(111, char),
+	    SYNC_FIELD_AT(112, char),
+	    SYNC_FIELD_AT(113, char),
+	    SYNC_FIELD_AT(114, char),
+	    SYNC_FIELD_AT(115, char),
+	    SYNC_FIELD_AT(116, char),
+	    SYNC_FIELD_AT(117, char),
+	    SYNC_FIELD_AT(118, char),
+	    SYNC_FIELD_AT(119, char),
+	    SYNC_FIELD_AT(120, char),
+	    SYNC_FIELD_AT(121, char),
+	    SYNC_FIELD_AT(122, char),
+	    SYNC_FIELD_AT(124, int32_t),
+	    SYNC_FIELD_AT(128, int16_t),
+	    SYNC_FIELD_AT(132, int32_t),
+	    SYNC_FIELD_AT(136, int32_t),
+	    SYNC_FIELD_AT(140, char),
+	    SYNC_FIELD_AT(141, char),
+	    SYNC_FIELD_AT(142, char),
+	};
+
+	static constexpr SyncField g_PhysicalGameStateFields[] = {
+	    SYNC_FIELD_AT(0, char),
+	    SYNC_FIELD_AT(1, char),
+	    SYNC_FIELD_AT(2, char),
+	    SYNC_FIELD_AT(3, char),
+	    SYNC_FIELD_AT(4, char),
+	    SYNC_FIELD_AT(5, char),
+	    SYNC_FIELD_AT(6, char),
+	    SYNC_FIELD_AT(7, char),
+	    SYNC_FIELD_AT(8, char),
+	    SYNC_FIELD_AT(9, char),
+	    SYNC_FIELD_AT(12, int32_t),
+	    SYNC_FIELD_AT(16, int32_t),
+	    SYNC_FIELD_AT(20, int32_t),
+	};
+
+	static constexpr SyncField g_EntityScriptGameStateFields[] = {
+	    SYNC_FIELD_AT(0, char),
+	    SYNC_FIELD_AT(1, char),
+	    SYNC_FIELD_AT(2, char),
+	};
+
+	static constexpr SyncField g_PedScriptGameStateUncommonFields[] = {
+	    SYNC_FIELD_AT(16, int32_t),
+	    SYNC_FIELD_AT(27, char),
+	    SYNC_FIELD_AT(32, int32_t),
+	    SYNC_FIELD_AT(36, int16_t),
+	    SYNC_FIELD_AT(38, int32_t),
+	    SYNC_FIELD_AT(40, char),
+	    SYNC_FIELD_AT(41, char),
+	    SYNC_FIELD_AT(42, char),
+	    SYNC_FIELD_AT(43, char),
+	};
+
+	static constexpr SyncField g_PedEmotionalLocoFields[] = {
+	    SYNC_FIELD_AT(0, char),
+	    SYNC_FIELD_AT(4, int32_t),
+	    SYNC_FIELD_AT(12, int32_t), // some pointer
+	};
+
+	static constexpr SyncField g_PropSetGameStateFields[] = {
+	    SYNC_FIELD_AT(1, char),
+	    SYNC_FIELD_AT(91, char),
+	    SYNC_FIELD_AT(181, char),
+	    SYNC_FIELD_AT(272, int32_t),
+	    SYNC_FIELD_AT(276, char),
+	    SYNC_FIELD_AT(277, char),
+	};
+
+	static constexpr SyncField g_PlayerGameStateUncommonFields[] = {
+	    SYNC_FIELD_AT(0, char),
+	    SYNC_FIELD_AT(1, char),
+	    SYNC_FIELD_AT(2, char),
+	    SYNC_FIELD_AT(3, char),
+	    SYNC_FIELD_AT(4, char),
+	    SYNC_FIELD_AT(5, char),
+	    SYNC_FIELD_AT(6, char),
+	    SYNC_FIELD_AT(7, char),
+	    SYNC_FIELD_AT(8, char),
+	    SYNC_FIELD_AT(76, int64_t),
+	    SYNC_FIELD_AT(84, int32_t),
+	    SYNC_FIELD_AT(88, int16_t),
+	    SYNC_FIELD_AT(92, int32_t),
+	    SYNC_FIELD_AT(96, char),
+	    SYNC_FIELD_AT(97, char),
+	    SYNC_FIELD_AT(98, int16_t),
+	    SYNC_FIELD_AT(100, char),
+	    SYNC_FIELD_AT(101, char),
+	    SYNC_FIELD_AT(104, int32_t),
+	    SYNC_FIELD_AT(108, int32_t),
+	    SYNC_FIELD_AT(112, int32_t),
+	    SYNC_FIELD_AT(116, float),
+	    SYNC_FIELD_AT(120, int16_t),
+	    SYNC_FIELD_AT(144, int16_t),
+	    SYNC_FIELD_AT(146, int16_t),
+	    SYNC_FIELD_AT(148, char),
+	    SYNC_FIELD_AT(149, char),
+	    SYNC_FIELD_AT(150, char),
+	    SYNC_FIELD_AT(151, char),
+	    SYNC_FIELD_AT(152, char),
+	    SYNC_FIELD_AT(153, char),
+	    SYNC_FIELD_AT(154, char),
+	    SYNC_FIELD_AT(155, char),
+	};
+
+	static constexpr SyncField g_DynamicEntityGameStateFields[] = {
+	    SYNC_FIELD_AT(0, int32_t),
+	    SYNC_FIELD_AT(4, char),
+	    SYNC_FIELD_AT(8, int32_t),
+	    SYNC_FIELD_AT(12, int64_t),
+	};
+
+	static constexpr SyncField g_PedInteractionFields[] = {
+	    SYNC_FIELD_AT(0, int16_t),
+	    SYNC_FIELD_AT(2, int16_t),
+	    SYNC_FIELD_AT(4, int32_t),
+	    SYNC_FIELD_AT(8, int32_t),
+	    SYNC_FIELD_AT(12, int32_t),
+	    SYNC_FIELD_AT(16, int32_t),
+	    SYNC_FIELD_AT(28, int32_t),
+	    SYNC_FIELD_AT(32, int32_t),
+	    SYNC_FIELD_AT(36, int32_t),
+	    SYNC_FIELD_AT(40, int32_t),
+	    SYNC_FIELD_AT(44, int16_t),
+	    SYNC_FIELD_AT(48, int16_t),
+	    SYNC_FIELD_AT(50, char),
+	    SYNC_FIELD_AT(51, char),
+	};
+
+	static constexpr SyncField g_PhysicalScriptGameStateFields[] = {
+	    SYNC_FIELD_AT(0, char),
+	    SYNC_FIELD_AT(1, char),
+	    SYNC_FIELD_AT(2, char),
+	    SYNC_FIELD_AT(3, char),
+	    SYNC_FIELD_AT(4, char),
+	    SYNC_FIELD_AT(5, char),
+	    SYNC_FIELD_AT(6, char),
+	    SYNC_FIELD_AT(7, char),
+	    SYNC_FIELD_AT(8, char),
+	    SYNC_FIELD_AT(9, char),
+	    SYNC_FIELD_AT(10, char),
+	    SYNC_FIELD_AT(11, char),
+	    SYNC_FIELD_AT(12, char),
+	    SYNC_FIELD_AT(13, char),
+	    SYNC_FIELD_AT(14, char),
+	    SYNC_FIELD_AT(15, char),
+	    SYNC_FIELD_AT(16, char),
+	    SYNC_FIELD_AT(20, int32_t),
+	    SYNC_FIELD_AT(24, int32_t),
+	    SYNC_FIELD_AT(28, float),
+	    SYNC_FIELD_AT(32, int32_t),
+	};
+
+	static constexpr SyncField g_EntityScriptInfoFields[] = {
+	    SYNC_FIELD_AT(0, char),
+	    //SYNC_FIELD_AT(8, void*),
+	    SYNC_FIELD_AT(64, char),
+	    SYNC_FIELD_AT(68, int32_t),
+	    //SYNC_FIELD_AT(72, __m128i),
+	    SYNC_FIELD_AT(312, int32_t),
+	};
+
+	static constexpr SyncField g_DoorDamageFields[] = {
+	    SYNC_FIELD_AT(0, int32_t),
+	    SYNC_FIELD_AT(4, int64_t), // oword
+	    SYNC_FIELD_AT(20, int64_t), // oword
+	};
+
+	static constexpr SyncField g_PedOrientationFields[] = {
+	    SYNC_FIELD_AT(0, float),
+	    SYNC_FIELD_AT(4, float),
+	    SYNC_FIELD_AT(8, char),
+	    SYNC_FIELD_AT(9, char),
+	};
+
+	static constexpr SyncField g_PedWeaponFields[] = {
+	    SYNC_FIELD_AT(4, int16_t),
+	    SYNC_FIELD_AT(6, char),
+	    SYNC_FIELD_AT(7, char),
+	    SYNC_FIELD_AT(8, int),
+	    SYNC_FIELD_AT(476, int32_t),
+	    SYNC_FIELD_AT(480, int32_t),
+	    SYNC_FIELD_AT(484, int32_t),
+	    SYNC_FIELD_AT(488, int32_t),
+	    SYNC_FIELD_AT(492, char),
+	    SYNC_FIELD_AT(493, char),
+	    SYNC_FIELD_AT(494, char),
+	    SYNC_FIELD_AT(495, char),
+	    SYNC_FIELD_AT(496, char),
+	    SYNC_FIELD_AT(497, char),
+	    SYNC_FIELD_AT(498, char),
+	    SYNC_FIELD_AT(799, char),
+	    // untested
+	    SYNC_FIELD_AT(16, int64_t),
+	    SYNC_FIELD_AT(24, int32_t),
+	    SYNC_FIELD_AT(32, int16_t),
+	    SYNC_FIELD_AT(40, int32_t),
+	};
+
+	static constexpr SyncField g_PedInventoryFields[] = {
+	    SYNC_FIELD_AT(4000, int),
+	    SYNC_FIELD_AT(4080, int),
+	    SYNC_FIELD_AT(4084, int),
+	    SYNC_FIELD_AT(4184, int),
+	    SYNC_FIELD_AT(4284, int),
+	    SYNC_FIELD_AT(4288, char),
+	    SYNC_FIELD_AT(4308, char),
+	    SYNC_FIELD_AT(4328, char),
+	    SYNC_FIELD_AT(5328, char),
+	    SYNC_FIELD_AT(5353, char),
+	};
+
+	static constexpr SyncField g_Node_14359d660Fields[] = {
+	    SYNC_FIELD_AT(36, uint32_t),
+	    SYNC_FIELD_ARRAY_AT(56, uint32_t, 16, 36),
+	    SYNC_FIELD_ARRAY_AT(60, uint32_t, 16, 36),
+	    SYNC_FIELD_ARRAY_AT(64, uint32_t, 16, 36),
+	    SYNC_FIELD_ARRAY_AT(68, uint32_t, 16, 36),
+	    SYNC_FIELD_ARRAY_AT(72, uint32_t, 16, 36),
+	};
+
+	static constexpr SyncField g_DraftVehGameStateFields[] = {
+	    SYNC_FIELD_AT(0, char),
+	    SYNC_FIELD_AT(1, char),
+	    SYNC_FIELD_AT(2, char),
+	    SYNC_FIELD_AT(3, char),
+	    SYNC_FIELD_AT(4, char),
+	};
+
+	static constexpr SyncField g_PhysicalHealthFields[] = {
+	    SYNC_FIELD_AT(0, int),
+	    SYNC_FIELD_AT(4, int),
+	    SYNC_FIELD_AT(8, int16_t),
+	    SYNC_FIELD_AT(10, int),
+	    SYNC_FIELD_AT(16, int),
+	    SYNC_FIELD_AT(20, char),
+	    SYNC_FIELD_AT(21, char),
+	};
+
+	static constexpr SyncField g_Node_143599c30Fields[] = {
+	    SYNC_FIELD_AT(80, int),
+	    SYNC_FIELD_AT(84, char),
+	    SYNC_FIELD_AT(85, char),
+	};
+
+	static constexpr SyncField g_AutomobileCreationFields[] = {
+	    SYNC_FIELD_AT(0, char),
+	    SYNC_FIELD_ARRAY_AT(14, int, 10, 1),
+	    SYNC_FIELD_AT(24, int),
+	};
+
+	static constexpr SyncField g_DraftVehCreationNodeThingFields[] = {
+	    SYNC_FIELD_AT(0, int),
+	    SYNC_FIELD_AT(48, char),
+	};
+
+	// size is only needed by nodes with an extra formatter, the extent of the fields covers the rest
+	static constexpr SyncNodeLayout Layout(std::uint32_t id, std::span<const SyncField> fields, SyncNodeFormatter extra = nullptr, std::uint32_t size = 0)
+	{
+		return {id, fields, extra, std::max(size, GetSyncFieldsExtent(fields))};
+	}
+
+	static constexpr SyncNodeLayout g_Layouts[] = {
+	    Layout("CPedCreationNode"_J, g_PedCreationFields),
+	    Layout("CAnimalCreationNode"_J, g_AnimalCreationFields),
+	    Layout("CObjectCreationNode"_J, g_ObjectCreationFields),
+	    Layout("CPlayerAppearanceNode"_J, g_PlayerAppearanceFields),
+	    Layout("CVehicleCreationNode"_J, g_VehicleCreationFields),
+	    Layout("CPickupCreationNode"_J, g_PickupCreationFields),
+	    Layout("CPhysicalAttachNode"_J, g_PhysicalAttachFields),
+	    Layout("CVehicleProximityMigrationNode"_J, g_VehicleProximityMigrationFields),
+	    Layout("CPedTaskTreeNode"_J, g_PedTaskTreeFields, &FormatPedTaskTree, sizeof(CPedTaskTreeData)),
+	    Layout("CPedAttachNode"_J, g_PedAttachFields),
+	    Layout("CVehicleGadgetNode"_J, g_VehicleGadgetFields, &FormatVehicleGadget, sizeof(CVehicleGadgetData)),
+	    Layout("CPropSetCreationNode"_J, g_PropSetCreationFields),
+	    Layout("CProjectileCreationNode"_J, g_ProjectileCreationFields),
+	    Layout("CTrainGameStateUncommonNode"_J, g_TrainGameStateUncommonFields),
+	    Layout("CTrainGameStateNode"_J, g_TrainGameStateFields),
+	    Layout("CTrainControlNode"_J, g_TrainControlFields),
+	    Layout("CAnimSceneCreationNode"_J, g_AnimSceneCreationFields),
+	    Layout("CAnimSceneFrequentNode"_J, g_AnimSceneFrequentFields),
+	    Layout("CAnimSceneInfrequentNode"_J, g_AnimSceneInfrequentFields),
+	    Layout("CPedGameStateCommonNode"_J, g_PedGameStateCommonFields),
+	    Layout("CPedSectorPosMapNode"_J, g_PedSectorPosMapFields),
+	    Layout("CPedSectorPosNavMeshNode"_J, g_PedSectorPosNavMeshFields),
+	    Layout("CPedMovementNode"_J, g_PedMovementFields),
+	    Layout("CDraftVehControlNode"_J, g_DraftVehControlFields),
+	    Layout("Node_14359d020"_J, g_Node_14359d020Fields),
+	    Layout("CVehicleControlNode"_J, g_VehicleControlFields),
+	    Layout("CVehicleAngVelocityNode"_J, g_VehicleAngVelocityFields),
+	    Layout("CDraftVehHorseHealthNode"_J, g_DraftVehHorseHealthFields),
+	    Layout("CVehicleGameStateNode"_J, g_VehicleGameStateFields),
+	    Layout("CPedStandingOnObjectNode"_J, g_PedStandingOnObjectFields),
+	    Layout("Node_143594ab8"_J, g_Node_143594ab8Fields),
+	    Layout("CVehicleScriptGameStateNode"_J, g_VehicleScriptGameStateFields),
+	    Layout("CPhysicalGameState"_J, g_PhysicalGameStateFields),
+	    Layout("CEntityScriptGameStateNode"_J, g_EntityScriptGameStateFields),
+	    Layout("CPedScriptGameStateUncommonNode"_J, g_PedScriptGameStateUncommonFields),
+	    Layout("CPedEmotionalLocoNode"_J, g_PedEmotionalLocoFields),
+	    Layout("CPropSetGameStateNode"_J, g_PropSetGameStateFields),
+	    Layout("CPlayerGameStateUncommonNode"_J, g_PlayerGameStateUncommonFields),
+	    Layout("CPhysicalGameStateNode"_J, g_PhysicalGameStateFields),
+	    Layout("CDynamicEntityGameStateNode"_J, g_DynamicEntityGameStateFields),
+	    Layout("CPedInteractionNode"_J, g_PedInteractionFields),
+	    Layout("CPhysicalScriptGameStateNode"_J, g_PhysicalScriptGameStateFields),
+	    Layout("CEntityScriptInfoNode"_J, g_EntityScriptInfoFields),
+	    Layout("CDoorDamageNode"_J, g_DoorDamageFields),
+	    Layout("CPedOrientationNode"_J, g_PedOrientationFields),
+	    Layout("CPedWeaponNode"_J, g_PedWeaponFields),
+	    Layout("CPedInventoryNode"_J, g_PedInventoryFields),
+	    Layout("Node_14359d660"_J, g_Node_14359d660Fields),
+	    Layout("CDraftVehGameStateNode"_J, g_DraftVehGameStateFields),
+	    Layout("CPhysicalHealthNode"_J, g_PhysicalHealthFields),
+	    Layout("Node_143599c30"_J, g_Node_143599c30Fields),
+	    Layout("CAutomobileCreationNode"_J, g_AutomobileCreationFields),
+	    Layout("CDraftVehCreationNodeThing"_J, g_DraftVehCreationNodeThingFields),
+	};
+
+	const SyncNodeLayout* SyncNodeLayouts::Find(std::uint32_t id)
+	{
+		static const auto layouts = [] {
+			std::unordered_map<std::uint32_t, const SyncNodeLayout*> layouts;
+			for (const auto& layout : g_Layouts)
+				layouts.emplace(layout.m_Id, &layout);
+			return layouts;
+		}();
+
+		if (auto it = layouts.find(id); it != layouts.end())
+			return it->second;
+		return nullptr;
+	}
+
+	bool SyncNodeLayouts::ExportCapture(const std::filesystem::path& file)
+	{
+		std::ofstream stream(file, std::ios::out | std::ios::trunc);
+		if (!stream)
+			return false;
+
+		std::unordered_map<std::uint32_t, const char*> names;
+		for (const auto& id : Nodes::GetAllNodeIds())
+			names.emplace(id.id, id.name);
+
+		const auto capture = SyncNodeDumper::GetCapture();
+		std::string record;
+		SyncNodeDumper::ForEachCaptured(capture, [&](const SyncNodeDumper::CaptureHeader& header, const std::uint8_t* data) {
+			const auto time = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(header.m_Time)));
+			const auto name = names.find(header.m_Node);
+
+			record.clear();
+			record += std::format("[{:%T}] ", std::chrono::floor<std::chrono::milliseconds>(time));
+			record += header.m_Flags & SyncNodeDumper::g_CaptureOutgoing ? "OUTGOING" : header.m_Player == 0xFF ? "UNKNOWN" : std::format("player {}", header.m_Player);
+			record += std::format(": {}, {}", name != names.end() ? name->second : "UNKNOWN NODE", header.m_ObjectId);
+
+			// layouts only read within m_Size, which is fixed per node
+			if (const auto layout = Find(header.m_Node); layout && header.m_Size == layout->m_Size)
+				SyncNodeDumper::Format(record, *layout, data);
+
+			stream << record << '\n';
+		});
+
+		return static_cast<bool>(stream);
+	}
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "game/backend/SyncNodeDumper.hpp"
+
+namespace YimMenu
+{
+	/**
+	 * @brief Field descriptors of the sync node data we know the layout of
+	 */
+	class SyncNodeLayouts
+	{
+	public:
+		static const SyncNodeLayout* Find(std::uint32_t id);
+
+		/**
+		 * @brief Writes every node in the clone capture as text, one record per node
+		 */
+		static bool ExportCapture(const std::filesystem::path& file);
+	};
+}
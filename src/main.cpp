@@ -4,6 +4,10 @@
 #include "core/frontend/Notifications.hpp"
 #include "core/hooking/Hooking.hpp"
 #include "core/memory/ModuleMgr.hpp"
+#include "core/misc/FlightRecorder.hpp"
+#include "core/misc/StartupTimer.hpp"
+#include "core/misc/Tracer.hpp"
+#include "core/misc/WorkerPool.hpp"
 #include "game/backend/PlayerDatabase.hpp"
 #include "core/renderer/Renderer.hpp"
 #include "core/settings/Settings.hpp"
@@ -19,40 +23,76 @@
 
 namespace YimMenu
 {
+	static std::chrono::milliseconds GetThreadCpuTime()
+	{
+		FILETIME creation, exit, kernel, user;
+		if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+			return {};
+
+		const auto ticks = (static_cast<std::uint64_t>(kernel.dwHighDateTime) << 32 | kernel.dwLowDateTime)
+		    + (static_cast<std::uint64_t>(user.dwHighDateTime) << 32 | user.dwLowDateTime);
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::nanoseconds(ticks * 100));
+	}
+
 	static DWORD Main(void*)
 	{
+		TRACE_THREAD_NAME("Main");
+
 		const auto documents = std::filesystem::path(std::getenv("appdata")) / "HorseMenu";
 		FileMgr::Init(documents);
 
 		LogHelper::Init("Terminus", FileMgr::GetProjectFile("./cout.log"));
+		FlightRecorder::SetDumpFile(FileMgr::GetProjectFile("./crash_events.bin").Path());
+		WorkerPool::Init(2);
 
 		g_HotkeySystem.RegisterCommands();
 		SavedLocations::FetchSavedLocations();
 		Settings::Initialize(FileMgr::GetProjectFile("./settings.json"));
 
 		auto PlayerDatabaseInstance = std::make_unique<PlayerDatabase>();
+		StartupTimer::Mark("Settings");
 
 		if (!ModuleMgr.LoadModules())
 			goto unload;
 		if (!Pointers.Init())
 			goto unload;
 
+		if (!Pointers.WaitFor(PatternPriority::HOOK))
+			goto unload;
 		Hooking::Init();
+		StartupTimer::Mark("Hooks");
 
 		if (!Renderer::Init())
 			goto unload;
+		StartupTimer::Mark("Renderer");
 
 		if (!Pointers.LateInit())
-			LOG(WARNING) << "Failed to find some pointers";
+			goto unload;
 		Hooking::LateInit();
 
 		ScriptMgr::Init();
+		ScriptMgr::SetTaskErrorHandler([](std::exception_ptr error) {
+			// the tick runs inside the script thread hook, a failed task must not unwind into the game
+			try
+			{
+				std::rethrow_exception(error);
+			}
+			catch (const std::exception& e)
+			{
+				LOG(WARNING) << "Task failed: " << e.what();
+			}
+			catch (...)
+			{
+				LOG(WARNING) << "Task failed with an unknown exception";
+			}
+		});
 		LOG(INFO) << "ScriptMgr initialized";
 
 		FiberPool::Init(5);
 		LOG(INFO) << "FiberPool initialized";
 
 		GUI::Init();
+		StartupTimer::Mark("GUI");
 
 		ScriptMgr::AddScript(std::make_unique<Script>(&FeatureLoop));
 		ScriptMgr::AddScript(std::make_unique<Script>(&BlockControlsForUI));
@@ -65,12 +105,11 @@ namespace YimMenu
 		LOG(WARNING) << "Debug Build. Switch to RelWithDebInfo or Release build configurations to have a more stable experience.";
 #endif
 
-		while (g_Running)
-		{
-			Settings::Tick(); // TODO: move this somewhere else
-		}
+		// settings are written by their own worker, nothing left to do here until we unload
+		g_Running.wait(true);
 
 		LOG(INFO) << "Unloading";
+		LOG(INFO) << "Main thread used " << GetThreadCpuTime().count() << "ms of CPU time";
 
 		NativeHooks::Destroy();
 		LOG(INFO) << "NativeHooks uninitialized";
@@ -84,11 +123,22 @@ namespace YimMenu
 		PlayerDatabaseInstance.reset();
 
 	unload:
+		// queued saves are written before anything they depend on goes away
+		WorkerPool::Destroy();
+		LOG(INFO) << "WorkerPool uninitialized";
+		Settings::Destroy();
+		LOG(INFO) << "Settings saved";
+		Pointers.Restore();
 		Hooking::Destroy();
 		LOG(INFO) << "Hooking uninitialized";
 		Renderer::Destroy();
 		LOG(INFO) << "Renderer uninitialized";
 
+#ifdef TERMINUS_TRACING
+		if (Tracer::Dump(FileMgr::GetProjectFile("./trace.json").Path()))
+			LOG(INFO) << "Trace written to trace.json";
+#endif
+
 		LOG(INFO) << "Goodbye!";
 		LogHelper::Destroy();
 
@@ -106,6 +156,7 @@ BOOL WINAPI DllMain(HINSTANCE dllInstance, DWORD reason, void*)
 	if (reason == DLL_PROCESS_ATTACH)
 	{
 		g_DllInstance = dllInstance;
+		StartupTimer::Start();
 
 		g_MainThread = CreateThread(nullptr, 0, Main, nullptr, 0, &g_MainThreadId);
 	}
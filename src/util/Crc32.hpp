@@ -0,0 +1,33 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace YimMenu
+{
+	namespace Detail
+	{
+		inline constexpr auto g_Crc32Table = [] {
+			std::array<std::uint32_t, 256> table{};
+			for (std::uint32_t i = 0; i < 256; i++)
+			{
+				auto crc = i;
+				for (int bit = 0; bit < 8; bit++)
+					crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320 : 0);
+				table[i] = crc;
+			}
+			return table;
+		}();
+	}
+
+	/**
+	 * @brief CRC-32 (IEEE 802.3), pass the previous result as crc to checksum data in pieces
+	 */
+	inline constexpr std::uint32_t Crc32(std::span<const std::uint8_t> data, std::uint32_t crc = 0)
+	{
+		crc = ~crc;
+		for (const auto byte : data)
+			crc = Detail::g_Crc32Table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+		return ~crc;
+	}
+}
@@ -11,7 +11,21 @@ namespace YimMenu
 		return c >= 'A' && c <= 'Z' ? c | 1 << 5 : c;
 	}
 
-	extern constexpr joaat_t Joaat(const std::string_view str);
+	inline constexpr joaat_t Joaat(const std::string_view str)
+	{
+		joaat_t hash = 0;
+		for (auto c : str)
+		{
+			hash += ToLower(c);
+			hash += (hash << 10);
+			hash ^= (hash >> 6);
+		}
+		hash += (hash << 3);
+		hash ^= (hash >> 11);
+		hash += (hash << 15);
+		return hash;
+	}
+
 	inline consteval joaat_t operator""_J(const char* s, std::size_t n)
 	{
 		joaat_t result = 0;
@@ -0,0 +1,20 @@
+#pragma once
+#include <ostream>
+#include <string_view>
+
+namespace YimMenu
+{
+	/**
+	 * @brief Writes a string into a JSON string literal, quotes and backslashes are escaped and control characters dropped
+	 */
+	inline void WriteJsonEscaped(std::ostream& stream, std::string_view string)
+	{
+		for (const auto c : string)
+		{
+			if (c == '"' || c == '\\')
+				stream << '\\' << c;
+			else if (static_cast<unsigned char>(c) >= 0x20)
+				stream << c;
+		}
+	}
+}
\ No newline at end of file
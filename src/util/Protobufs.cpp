@@ -1,4 +1,5 @@
 #include "Protobufs.hpp"
+#include "ProtobufStream.hpp"
 #include "StrToHex.hpp"
 
 namespace YimMenu
@@ -46,111 +47,6 @@ namespace YimMenu
 		I32 = 5
 	};
 
-	// reader only for now
-	class ProtobufStream
-	{
-		std::uint8_t* m_Data;
-		std::size_t m_Size;
-		std::size_t m_Position;
-
-	public:
-		ProtobufStream(void* data, std::size_t size) :
-		    m_Data(reinterpret_cast<std::uint8_t*>(data)),
-		    m_Size(size),
-		    m_Position(0)
-		{
-		}
-
-		bool IsEof() const
-		{
-			return m_Position >= m_Size;
-		}
-
-		std::uint8_t ReadByte()
-		{
-			if (IsEof())
-				return 0;
-
-			return m_Data[m_Position++];
-		}
-
-		std::uint64_t ReadVarInt()
-		{
-			std::uint8_t byte;
-			std::uint_fast8_t bitpos = 0;
-			std::uint64_t result     = 0;
-
-			do
-			{
-				if (bitpos >= 64)
-					return 0;
-
-				byte = ReadByte();
-
-				result |= (std::uint64_t)(byte & 0x7F) << bitpos;
-				bitpos = (std::uint_fast8_t)(bitpos + 7);
-			} while (byte & 0x80);
-
-			return result;
-		}
-
-		std::uint64_t ReadUInt64()
-		{
-			if (IsEof())
-				return 0;
-
-			auto res = *reinterpret_cast<std::uint64_t*>(&m_Data[m_Position]);
-			m_Position += 8;
-			return res;
-		}
-
-		std::uint64_t ReadUInt32()
-		{
-			if (IsEof())
-				return 0;
-
-			auto res = *reinterpret_cast<std::uint32_t*>(&m_Data[m_Position]);
-			m_Position += 4;
-			return res;
-		}
-
-		ProtobufStream ExtractSubMessage(std::size_t size)
-		{
-			ProtobufStream stream(&m_Data[m_Position], size);
-			m_Position += size;
-			return stream;
-		}
-
-		std::string ReadString(std::size_t len)
-		{
-			if (IsEof())
-				return "";
-
-			std::string str(reinterpret_cast<char*>(&m_Data[m_Position]), len);
-			m_Position += len;
-			return str;
-		}
-
-		std::vector<std::uint8_t> ReadBytes(std::size_t len)
-		{
-			if (IsEof())
-				return {};
-
-			std::vector<std::uint8_t> out;
-			out.reserve(len);
-
-			for (int i = 0; i < len; i++)
-				out.push_back(ReadByte());
-
-			return out;
-		}
-
-		void Seek(int len)
-		{
-			m_Position += len;
-		}
-	};
-
 	class ProtobufStructure
 	{
 		pb_element* m_Fields;
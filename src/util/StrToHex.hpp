@@ -1,5 +1,8 @@
 #pragma once
 #include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
 
 namespace YimMenu
 {
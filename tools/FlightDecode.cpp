@@ -0,0 +1,145 @@
+// Flight recorder decoder: renders the crash_events.bin written by the exception handler as text,
+// oldest event first so the crash ends up at the bottom.
+//
+// usage: TerminusFlightDecode <crash_events.bin> [--last <count>] [--thread <id>]
+//   --last    only print the most recent <count> events
+//   --thread  only print events recorded by the thread with the given id, as shown in the stack trace
+
+#include "core/misc/FlightRecorder.hpp"
+
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+using namespace YimMenu;
+
+namespace
+{
+	struct Options
+	{
+		std::filesystem::path m_Dump;
+		std::size_t m_Last = 0;
+		std::optional<std::uint32_t> m_Thread;
+	};
+
+	std::optional<Options> ParseOptions(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; i++)
+		{
+			const std::string_view arg = argv[i];
+			if (arg == "--last" && i + 1 < argc)
+				options.m_Last = std::strtoull(argv[++i], nullptr, 10);
+			else if (arg == "--thread" && i + 1 < argc)
+				options.m_Thread = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+			else if (options.m_Dump.empty() && !arg.starts_with("--"))
+				options.m_Dump = arg;
+			else
+				return std::nullopt;
+		}
+
+		if (options.m_Dump.empty())
+			return std::nullopt;
+		return options;
+	}
+
+	void PrintTime(std::ostream& stream, std::int64_t nanoseconds)
+	{
+		const auto seconds = static_cast<std::time_t>(nanoseconds / 1'000'000'000);
+		std::tm time{};
+#ifdef _WIN32
+		localtime_s(&time, &seconds);
+#else
+		localtime_r(&seconds, &time);
+#endif
+		stream << std::put_time(&time, "%Y-%m-%d %H:%M:%S") << '.' << std::setw(6) << std::setfill('0') << (nanoseconds / 1000) % 1'000'000 << std::setfill(' ');
+	}
+
+	void PrintRecord(std::ostream& stream, const FlightRecorder::Entry& record)
+	{
+		const auto event = static_cast<std::size_t>(record.m_Event);
+		if (event >= g_FlightEventInfo.size())
+		{
+			stream << "UNKNOWN(" << event << ")";
+			for (const auto arg : record.m_Args)
+				stream << " 0x" << std::hex << arg << std::dec;
+			return;
+		}
+
+		const auto& info = g_FlightEventInfo[event];
+		stream << std::left << std::setw(12) << info.m_Name << std::right;
+		for (std::size_t i = 0; i < info.m_Args.size(); i++)
+		{
+			const auto& arg = info.m_Args[i];
+			if (!arg.m_Name)
+				continue;
+
+			stream << ' ' << arg.m_Name << '=';
+			if (arg.m_Hex)
+				stream << "0x" << std::hex << record.m_Args[i] << std::dec;
+			else
+				stream << static_cast<std::int64_t>(record.m_Args[i]);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const auto options = ParseOptions(argc, argv);
+	if (!options)
+	{
+		std::cerr << "usage: TerminusFlightDecode <crash_events.bin> [--last <count>] [--thread <id>]\n";
+		return 2;
+	}
+
+	std::ifstream file(options->m_Dump, std::ios::binary);
+	FlightRecorder::DumpHeader header;
+	if (!file || !file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+	{
+		std::cerr << "failed to read " << options->m_Dump << "\n";
+		return 1;
+	}
+
+	if (header.m_Magic != FlightRecorder::DumpHeader::Magic || header.m_Version != FlightRecorder::DumpHeader::Version
+	    || header.m_RecordSize != sizeof(FlightRecorder::Entry) || header.m_TicksPerSecond <= 0)
+	{
+		std::cerr << options->m_Dump << " is not a flight recorder dump or was written by another version\n";
+		return 1;
+	}
+
+	std::vector<FlightRecorder::Entry> records(header.m_Count);
+	if (!file.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(FlightRecorder::Entry)))
+	{
+		std::cerr << options->m_Dump << " is truncated\n";
+		return 1;
+	}
+
+	if (options->m_Thread)
+		std::erase_if(records, [&](const FlightRecorder::Entry& record) {
+			return record.m_Thread != *options->m_Thread;
+		});
+
+	const auto first = options->m_Last && options->m_Last < records.size() ? records.size() - options->m_Last : 0;
+	const auto toNanoseconds = [&](std::uint64_t ticks) {
+		return static_cast<std::int64_t>((static_cast<double>(ticks) - static_cast<double>(header.m_StartTicks)) / header.m_TicksPerSecond * 1e9);
+	};
+
+	std::cout << "# " << header.m_Count << " events, showing " << records.size() - first << "\n";
+	std::cout << std::fixed << std::setprecision(3);
+	for (auto i = first; i < records.size(); i++)
+	{
+		const auto& record = records[i];
+		const auto delta   = i > first ? toNanoseconds(record.m_Timestamp) - toNanoseconds(records[i - 1].m_Timestamp) : 0;
+
+		PrintTime(std::cout, header.m_StartTime + toNanoseconds(record.m_Timestamp));
+		std::cout << "  +" << std::setw(10) << delta / 1e6 << "ms  T" << std::left << std::setw(6) << record.m_Thread << std::right << "  ";
+		PrintRecord(std::cout, record);
+		std::cout << "\n";
+	}
+	return 0;
+}
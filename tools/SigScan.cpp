@@ -0,0 +1,218 @@
+// Offline signature scanner: checks every pattern from game/pointers/Patterns.hpp against a RDR2.exe
+// image on disk and optionally writes the pattern_cache.bin the menu would have produced for it.
+//
+// usage: TerminusSigScan <RDR2.exe> [--mapped] [--cache <pattern_cache.bin>] [--analyze [--report <report.json>]]
+//   --mapped   the image is a memory dump of the loaded module instead of the file on disk
+//   --analyze  counts all matches of every pattern and proposes shorter or disambiguated signatures,
+//              fails if any pattern is ambiguous. --report additionally writes the results as JSON
+
+#include "core/backend/PatternCache.hpp"
+#include "core/memory/PeImage.hpp"
+#include "core/memory/PointerCalculator.hpp"
+#include "core/memory/ScanEngine.hpp"
+#include "core/memory/SignatureAnalyzer.hpp"
+#include "game/pointers/Patterns.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string_view>
+
+using namespace YimMenu;
+
+namespace
+{
+	struct Options
+	{
+		std::filesystem::path m_Image;
+		std::filesystem::path m_Cache;
+		std::filesystem::path m_Report;
+		bool m_Analyze = false;
+		PeLayout m_Layout = PeLayout::FILE;
+	};
+
+	std::optional<Options> ParseOptions(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; i++)
+		{
+			const std::string_view arg = argv[i];
+			if (arg == "--mapped")
+				options.m_Layout = PeLayout::MAPPED;
+			else if (arg == "--cache" && i + 1 < argc)
+				options.m_Cache = argv[++i];
+			else if (arg == "--analyze")
+				options.m_Analyze = true;
+			else if (arg == "--report" && i + 1 < argc)
+				options.m_Report = argv[++i];
+			else if (options.m_Image.empty() && !arg.starts_with("--"))
+				options.m_Image = arg;
+			else
+				return std::nullopt;
+		}
+
+		if (options.m_Image.empty() || (!options.m_Report.empty() && !options.m_Analyze))
+			return std::nullopt;
+		return options;
+	}
+
+	double MillisecondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// looks for a second hit after the first one, the scanner would silently take the first
+	bool HasSecondHit(const ScanEngine& engine, const PeImage& image, const IPattern* pattern, std::size_t first)
+	{
+		const auto packed = pattern->Packed();
+		for (const auto& range : image.Ranges(pattern->Section()))
+		{
+			const auto begin = std::max(range.m_Begin, first + 1);
+			const auto end   = std::min(range.m_End + std::max<std::size_t>(packed.Size(), 1) - 1, engine.Image().size());
+			if (begin < end && SignatureMatcher::FindFirst(engine.Image().subspan(begin, end - begin), packed))
+				return true;
+		}
+		return false;
+	}
+
+	int Analyze(const Options& options, std::span<const std::uint8_t> buffer, const PeImage& image)
+	{
+		const auto start   = std::chrono::steady_clock::now();
+		const auto reports = SignatureAnalyzer::Analyze(buffer, &image, Patterns::All);
+		const auto time    = MillisecondsSince(start);
+
+		std::size_t ambiguous = 0, missing = 0, shortenable = 0;
+		std::cout << std::left << std::setw(40) << "pattern" << std::setw(10) << "matches" << "proposal" << std::endl;
+		for (const auto& report : reports)
+		{
+			if (report.m_Matches.empty())
+				missing++;
+			else if (report.Ambiguous())
+				ambiguous++;
+			else if (report.m_Proposal)
+				shortenable++;
+
+			std::cout << std::left << std::setw(40) << report.m_Pattern->Name() << std::setw(10) << report.m_Matches.size();
+			if (report.m_Proposal)
+				std::cout << (report.Ambiguous() ? "unique as " : "shortest unique ") << '"' << *report.m_Proposal << '"';
+			else if (report.Ambiguous())
+				std::cout << "no unique extension within reach";
+			std::cout << std::endl;
+		}
+
+		std::cout << std::endl
+		          << ambiguous << " ambiguous, " << missing << " missed, " << shortenable << " could be shorter, analyzed in "
+		          << std::fixed << std::setprecision(1) << time << " ms" << std::endl;
+
+		if (!options.m_Report.empty())
+		{
+			std::ofstream report(options.m_Report);
+			report << SignatureAnalyzer::ToJson(reports, &image);
+			if (!report)
+			{
+				std::cerr << "Failed to write " << options.m_Report << std::endl;
+				return 2;
+			}
+			std::cout << "Wrote report to " << options.m_Report << std::endl;
+		}
+
+		return ambiguous || missing ? 1 : 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const auto options = ParseOptions(argc, argv);
+	if (!options)
+	{
+		std::cerr << "usage: " << argv[0] << " <RDR2.exe> [--mapped] [--cache <pattern_cache.bin>] [--analyze [--report <report.json>]]" << std::endl;
+		return 2;
+	}
+
+	std::ifstream stream(options->m_Image, std::ios_base::binary);
+	if (!stream)
+	{
+		std::cerr << "Failed to open " << options->m_Image << std::endl;
+		return 2;
+	}
+	const std::vector<std::uint8_t> buffer{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+
+	const auto image = PeImage::Parse(buffer, options->m_Layout);
+	if (!image)
+	{
+		std::cerr << options->m_Image << " is not a valid PE image" << std::endl;
+		return 2;
+	}
+
+	if (options->m_Analyze)
+		return Analyze(*options, buffer, *image);
+
+	ScanEngine engine(buffer);
+	engine.SetRanges(SectionClass::CODE, image->Ranges(SectionClass::CODE));
+	engine.SetRanges(SectionClass::DATA, image->Ranges(SectionClass::DATA));
+	for (const auto pattern : Patterns::All)
+		engine.Add(pattern->Packed(), pattern->Section());
+
+	const auto scanStart = std::chrono::steady_clock::now();
+	const auto results   = engine.Run();
+	const auto scanTime  = MillisecondsSince(scanStart);
+
+	const PointerCalculator base(nullptr);
+	std::size_t hits = 0, misses = 0, multiHits = 0;
+	std::vector<std::pair<const IPattern*, std::uint32_t>> resolved;
+
+	std::cout << std::left << std::setw(40) << "pattern" << std::setw(10) << "result" << std::setw(14) << "rva" << "verify ms" << std::endl;
+	for (std::size_t i = 0; i < std::size(Patterns::All); i++)
+	{
+		const auto pattern = Patterns::All[i];
+		const auto start   = std::chrono::steady_clock::now();
+
+		std::string_view result = "miss";
+		std::optional<std::uint32_t> rva;
+		if (results[i])
+		{
+			rva    = image->OffsetToRva(results[i].value());
+			result = HasSecondHit(engine, *image, pattern, results[i].value()) ? "multi" : "hit";
+		}
+
+		const auto time = MillisecondsSince(start);
+
+		std::cout << std::left << std::setw(40) << pattern->Name() << std::setw(10) << result;
+		if (rva)
+			std::cout << "0x" << std::hex << std::uppercase << std::setw(12) << base.Add(*rva).As<std::uintptr_t>() << std::dec << std::nouppercase;
+		else
+			std::cout << std::setw(14) << "-";
+		std::cout << std::fixed << std::setprecision(3) << time << std::endl;
+
+		if (!results[i])
+		{
+			misses++;
+			continue;
+		}
+
+		hits++;
+		if (result == "multi")
+			multiHits++;
+		if (rva)
+			resolved.emplace_back(pattern, *rva);
+	}
+
+	std::cout << std::endl
+	          << hits << " hit (" << multiHits << " with more than one match), " << misses << " missed, "
+	          << engine.BytesToScan() / 1024 << " KiB scanned in " << std::fixed << std::setprecision(1) << scanTime << " ms" << std::endl;
+
+	if (!options->m_Cache.empty())
+	{
+		// must match the ModuleInfo Pointers::Init builds from the loaded module
+		PatternCache::Init({image->SizeOfCode(), image->TimeDateStamp(), image->CheckSum()}, options->m_Cache);
+		for (const auto& [pattern, rva] : resolved)
+			PatternCache::UpdateCachedOffset(pattern->Hash(), rva);
+		PatternCache::Update();
+
+		std::cout << "Wrote " << resolved.size() << " offsets to " << options->m_Cache << std::endl;
+	}
+
+	return misses ? 1 : 0;
+}